@@ -1,38 +1,148 @@
 #include <GL/glew.h>
 #include <GLFW/glfw3.h>
 #include <glm/gtc/matrix_transform.hpp>
-#include "utils/render/ShadersUtils.h"
+#include "utils/render/ShaderManager.h"
+#include "utils/render/VertexFormat.h"
+#include "utils/render/InstancedMesh.h"
+#include "utils/render/DrawTable.h"
+#include "utils/render/HeadlessContext.h"
+#include "utils/render/FrameConstants.h"
+#include "utils/render/MaterialTable.h"
+#include "utils/render/RenderQueue.h"
+#include "utils/render/MultiDraw.h"
+#include "utils/render/ClusteredLights.h"
+#include "utils/render/ShadowCascades.h"
+#include "utils/mesh/MeshBuilder.h"
+#include "utils/memory/ArenaResource.h"
+#include "utils/jobs/ThreadPool.h"
+#include "utils/cache/ContentHash.h"
+#include "utils/cache/SceneCache.h"
+#include "utils/cache/ProgramCache.h"
+#include "utils/memory/AllocationTracker.h"
+#include "utils/mesh/MeshOptimizer.h"
+#include "utils/mesh/ShapeTables.h"
+#include "utils/culling/Bvh.h"
+#include "utils/culling/LodSelector.h"
+#include "utils/culling/OcclusionCuller.h"
+#include "utils/bake/LightBaker.h"
+#include "utils/profiling/FrameProfiler.h"
 #include "utils/Constants.h"
 #include <vector>
 #include <tuple>
+#include <cstring>
+#include <random>
+#include <chrono>
+#include <algorithm>
+#include <mutex>
+#include <functional>
+#include <numeric>
+#include <span>
 
 using namespace glm;
 using namespace std;
 
-struct Mesh {
-    vector<vec3> vertices;
-    vector<vec3> colors;
-    vector<GLfloat> shininesses;
-    vector<GLuint> indices;
-    vector<vec3> normals;
-    GLuint firstIndex;
-
-    Mesh(GLuint firstIndex,
-         vector<vec3> vertices,
-         vector<vec3> colors, vector<GLfloat> shininesses,
-         vector<GLuint> indices, vector<vec3> normals
-    ) : firstIndex(firstIndex), vertices(vertices), colors(colors),
-        shininesses(shininesses), indices(indices), normals(normals) {
-    }
-};
-
-GLuint shaderProgram;
+// Shader programs, one variant per permutation, replaced when the sources are edited
+ShaderManager shaderManager;
+string shaderDirectory = "../src/shaders"; // Selected with --shader-dir=path
+bool isShaderHotReloadEnabled = true; // Disabled with --no-hot-reload
+bool isPermutationEnabled = true; // Disabled with --no-permutations, which draws everything with the full shader
+bool isFogEnabled = true; // Disabled with --no-fog
+LightingModel lightingModel = LightingModel::PHONG; // Selected with --lighting-model=phong|blinn-phong
+vector<ShaderManager::VariantIndex> sceneVariants; // The variants the scene draws with, in draw order
+ShaderManager::VariantIndex treeVariant = 0;
 GLuint vao, vbo, ebo;
-
-// Locations - camera
-GLuint viewLocation, projLocation;
-// Locations - lighting
-GLuint viewPositionLocation, lightPositionLocation, lightColorLocation, skyColorLocation;
+DrawTable worldDrawTable;
+
+// Per-frame constants (camera, lighting, fog), uploaded only when they change
+FrameConstants frameConstants;
+
+// Vertex layout (selected with --vertex-layout=planar|interleaved)
+VertexLayout vertexLayout = VertexLayout::INTERLEAVED;
+GLsizei worldVertexCount = 0;
+
+// Trees - a single unit tree mesh drawn once per instance
+InstancedMesh trees;
+int forestTreeCount = 0; // Extra trees scattered around the platform (selected with --trees=N)
+AABB unitTreeBounds;
+
+// Culling - BVH items are the world submeshes followed by the tree instances, rebuilt whenever those change
+bool isCullingEnabled = true; // Disabled with --no-culling
+Bvh sceneBvh;
+vector<InstancedMesh::InstanceHandle> sceneBvhTreeHandles;
+uint64_t sceneBvhTreeVersion = 0; // Of the tree instances the BVH was built from
+vector<unsigned> visibleSceneItems;
+CullingStats cullingStats;
+
+// Occlusion culling - the world submeshes are the occluders, everything in the BVH is tested against them
+bool isOcclusionCullingEnabled = true; // Disabled with --no-occlusion
+OcclusionCuller occlusionCuller;
+
+// Shadows of the light - a cascade is redrawn only when it is re-centered on the camera, since the scene is static
+bool isShadowMappingEnabled = true; // Disabled with --no-shadows
+ShadowCascades shadowCascades;
+vector<unsigned> shadowCasterItems;
+vector<InstancedMesh::InstanceHandle> shadowTreeHandles;
+// A tree circling the house outside the scene BVH (enabled with --moving-tree), the dynamic caster of the shadows
+bool isMovingTreeEnabled = false;
+const float MOVING_TREE_RADIUS = 700.0f;
+const float MOVING_TREE_PERIOD = 20.0f; // Seconds per turn
+vector<MeshInstance> movingTrees;
+
+// Levels of detail - tree level switches below these projected diameters (in pixels)
+bool isLodEnabled = true; // Disabled with --no-lod
+
+// Vertex cache / overdraw / vertex fetch optimization of the static index buffers
+bool isIndexOptimizationEnabled = true; // Disabled with --no-index-optimization
+bool isWeldingEnabled = true; // Merging of duplicate vertices, disabled with --no-welding
+
+// Static lighting traced at scene generation (enabled with --bake-lighting) - ambient occlusion for everything,
+// shadowed diffuse light from lightPosition for the world, which is subdivided so the vertices can carry it
+bool isLightBakingEnabled = false;
+const float BAKE_MAX_EDGE_LENGTH = 50.0f;
+
+// Scene construction temporaries, released in one go once the scene is on the GPU
+ArenaResource sceneArena;
+bool isSceneArenaEnabled = true; // Disabled with --no-arena, which uses the global heap instead
+
+// Worker threads for scene generation
+ThreadPool threadPool;
+unsigned threadCount = 0; // Selected with --threads=N, 0 = one per hardware thread
+
+// Generated meshes are cached in a binary file and memory-mapped on later runs
+string sceneCachePath = "scene.cache"; // Selected with --scene-cache=path
+bool isSceneCacheEnabled = true; // Disabled with --no-scene-cache
+// Bumped whenever a generator or optimizer algorithm changes - the parameters and literal tables are hashed themselves
+const uint32_t SCENE_GENERATOR_VERSION = 3;
+
+// Linked shader programs are cached as driver binaries
+ProgramCache programCache;
+string programCacheDirectory = "shader-cache"; // Selected with --shader-cache=directory
+bool isProgramCacheEnabled = true; // Disabled with --no-shader-cache
+
+bool isShapeBenchmark = false; // --benchmark-shapes measures the shape generators and exits
+const LodSelector TREE_LOD_SELECTOR({160.0f, 70.0f, 25.0f}, 0.15f);
+vector<GLubyte> treeLodLevels; // Indexed by instance handle
+vector<vector<InstancedMesh::InstanceHandle>> visibleTreeHandlesByLod; // Each front to back
+
+// Draw ordering - submitted every frame, sorted by shader variant, mesh, material and distance
+RenderQueue renderQueue;
+const GLuint WORLD_MESH_ID = 0;
+const GLuint TREE_MESH_ID = 1;
+vector<GLubyte> worldRangeMaterials; // Most used material of each world range
+GLubyte treeMaterial = 0;
+// Visible trees keyed by level of detail & distance
+vector<RenderQueue::SortEntry> treeSortEntries, treeSortScratch;
+vector<uint32_t> nearestTreeDistanceBits; // Per level of detail
+MultiDraw worldDepthDraws; // World ranges of the depth only passes (occluders & shadows)
+
+// Point lights, shaded through clustered forward lighting
+ClusteredLights clusteredLights;
+int pointLightCount = 0; // Lamps scattered over the scene (selected with --lights=N)
+
+// Materials - the per-vertex material id indexes this table
+MaterialTable materialTable;
+// Highlights this broad aren't worth their cost, draws made only of such materials use a variant without specular
+const float MATTE_SHININESS = 1.0f;
 
 // Camera
 const float CAMERA_FOV = 75.0f;
@@ -40,6 +150,14 @@ const float CAMERA_NEAR_PLANE = 0.1f;
 const float CAMERA_FAR_PLANE = 5500.0f;
 const vec3 CAMERA_UP = vec3(0.0f, 1.0f, 0.0f);
 vec3 cameraPos = vec3(100.0f, 300.0f, -1500.0f);
+// Fog culling - the far plane is pulled in to where the fog hides everything, so the BVH rejects what's behind it
+bool isFogCullingEnabled = true; // Disabled with --no-fog-culling
+float cameraFarPlane = CAMERA_FAR_PLANE;
+vector<unsigned> unfoggedSceneItems; // Scratch for the statistics
+mat4 cullingView; // Of the last culled frame
+// Projection, rebuilt only when the framebuffer size changes
+mat4 cameraProjection;
+int cameraProjectionWidth = 0, cameraProjectionHeight = 0;
 vec3 cameraDirection = vec3(0.0f, 0.0f, 1.0f);
 float cameraYaw = 90.0f;
 float cameraPitch = 0.0f;
@@ -51,9 +169,24 @@ bool isFirstMouseCallback = true;
 float lastMouseX = Constants::WIDTH / 2.0;
 float lastMouseY = Constants::HEIGHT / 2.0;
 
+// Headless (selected with --headless, --frames=N, --output=frame.ppm)
+bool isHeadless = false;
+int headlessFrameCount = 600;
+const char *headlessOutputPath = nullptr;
+HeadlessContext headlessContext;
+const float HEADLESS_CAMERA_SWEEP = 360.0f; // Degrees of yaw covered over the run, so culling & LOD get exercised
+
 // Timing
 float deltaTime = 0.0f;
 float lastFrameTimestamp = 0.0f;
+const float FRAME_TIME_REPORT_INTERVAL = 5.0f;
+float frameTimeAccumulator = 0.0f;
+int frameTimeSamples = 0;
+
+// Profiling (per-frame CSV with --profile-csv=frames.csv)
+FrameProfiler profiler;
+FrameProfiler::StageId profileInput, profileUniforms, profileCulling, profileDraw, profilePresent;
+const char *profileCsvPath = nullptr;
 
 // Lighting
 const glm::vec3 LIGHT_COLOR = glm::vec3(0.6f, 0.6f, 0.6f);
@@ -82,6 +215,13 @@ void processInput(GLFWwindow *window) {
     }
 }
 
+void updateCameraDirection() {
+    cameraDirection.x = cos(glm::radians(cameraYaw)) * cos(glm::radians(cameraPitch));
+    cameraDirection.y = sin(glm::radians(cameraPitch));
+    cameraDirection.z = sin(glm::radians(cameraYaw)) * cos(glm::radians(cameraPitch));
+    cameraDirection = glm::normalize(cameraDirection);
+}
+
 void mouseCallback(GLFWwindow *_, double dMouseX, double dMouseY) {
     float mouseX = (float)(dMouseX);
     float mouseY = (float)(dMouseY);
@@ -106,10 +246,7 @@ void mouseCallback(GLFWwindow *_, double dMouseX, double dMouseY) {
         cameraPitch = -89.0f;
     }
 
-    cameraDirection.x = cos(glm::radians(cameraYaw)) * cos(glm::radians(cameraPitch));
-    cameraDirection.y = sin(glm::radians(cameraPitch));
-    cameraDirection.z = sin(glm::radians(cameraYaw)) * cos(glm::radians(cameraPitch));
-    cameraDirection = glm::normalize(cameraDirection);
+    updateCameraDirection();
 }
 
 GLFWwindow *initializeWindow() {
@@ -142,1376 +279,1625 @@ GLFWwindow *initializeWindow() {
     return window;
 }
 
-void initializeShaders() {
-    shaderProgram = ShadersUtils::loadShaders(
-            "../src/shaders/shader.vert",
-            "../src/shaders/shader.frag"
-    );
+void initializeHeadless() {
+    if (!headlessContext.create(Constants::WIDTH, Constants::HEIGHT)) {
+        exit(EXIT_FAILURE);
+    }
+
+    glewExperimental = GL_TRUE;
+    const auto glewResult = glewInit();
+#ifdef GLEW_ERROR_NO_GLX_DISPLAY
+    // The GL entry points are loaded before GLEW looks for a GLX display, which EGL contexts don't have
+    const auto isGlewReady = glewResult == GLEW_OK || glewResult == GLEW_ERROR_NO_GLX_DISPLAY;
+#else
+    const auto isGlewReady = glewResult == GLEW_OK;
+#endif
+    if (!isGlewReady) {
+        cout << "ERROR::HEADLESS::GLEW_INITIALIZATION_FAILED " << glewResult << endl;
+        exit(EXIT_FAILURE);
+    }
 
-    // Locations
-    viewLocation = glGetUniformLocation(shaderProgram, "viewShader");
-    projLocation = glGetUniformLocation(shaderProgram, "projectionShader");
-    viewPositionLocation = glGetUniformLocation(shaderProgram, "viewPosition");
-    lightPositionLocation = glGetUniformLocation(shaderProgram, "lightPosition");
-    lightColorLocation = glGetUniformLocation(shaderProgram, "lightColor");
-    skyColorLocation = glGetUniformLocation(shaderProgram, "skyColor");
+    if (!headlessContext.createFramebuffer()) {
+        exit(EXIT_FAILURE);
+    }
+    cout << "Headless: " << glGetString(GL_RENDERER) << ", " << glGetString(GL_VERSION) << endl;
 }
 
-Mesh combineMeshes(vector<Mesh> meshes) {
-    vector<vec3> vertices;
-    vector<vec3> colors;
-    vector<GLfloat> shininesses;
-    vector<GLuint> indices;
-    vector<vec3> normals;
-    for (const auto &mesh: meshes) {
-        vertices.insert(vertices.end(), mesh.vertices.begin(), mesh.vertices.end());
-        colors.insert(colors.end(), mesh.colors.begin(), mesh.colors.end());
-        shininesses.insert(shininesses.end(), mesh.shininesses.begin(), mesh.shininesses.end());
-        indices.insert(indices.end(), mesh.indices.begin(), mesh.indices.end());
-        normals.insert(normals.end(), mesh.normals.begin(), mesh.normals.end());
-    }
-
-    return Mesh(meshes[0].firstIndex, vertices, colors, shininesses, indices, normals);
+// Points a program at the shared state, also after a hot reload
+void bindShaderProgram(GLuint program) {
+    glUseProgram(program);
+    FrameConstants::bindProgram(program);
+    MaterialTable::bindProgram(program);
+    ClusteredLights::bindProgram(program);
+    ShadowCascades::bindProgram(program);
 }
 
-Mesh createPlatformAndHouseMesh() {
-    const vector<vec3> vertices = {
-            // Grass top
-            /* 0 (Grass top - 43) */vec3(-1029.73f, 0.0f, -920.41f),
-            /* 1 (Grass top - 32) */vec3(-96.5f, 0.0f, -920.41f),
-            /* 2 (Grass top - 65) */vec3(-1029.73f, 0.0f, 918.24f),
-            /* 3 (Grass top - 30) */vec3(-96.5f, 0.0f, -64.89f),
-            /* 4 (Grass top - 64) */vec3(880.5f, 0.0f, 918.24f),
-            /* 5 (Grass top - 25) */vec3(366.22f, 0.0f, -64.89f),
-            /* 6 (Grass top - 34) */vec3(366.22f, 0.0f, -920.41f),
-            /* 7 (Grass top - 58) */vec3(880.5f, 0.0f, -920.41f),
-            /* 8 (Grass top - 28) */vec3(47.62f, 0.0f, -40.76f),
-            /* 9 (Grass top - 29) */vec3(47.62f, 0.0f, -64.89f),
-            /* 10 (Grass top - 27) */vec3(233.2f, 0.0f, -40.76f),
-            /* 11 (Grass top - 35) */vec3(233.2f, 0.0f, -64.89f),
-            // Road top
-            /* 12 (Road top - 25) */vec3(366.22f, 0.0f, -64.89f),
-            /* 13 (Road top - 27) */vec3(233.2f, 0.0f, -40.76f),
-            /* 14 (Road top - 28) */vec3(47.62f, 0.0f, -40.76f),
-            /* 15 (Road top - 29) */vec3(47.62f, 0.0f, -64.89f),
-            /* 16 (Road top - 30) */vec3(-96.5f, 0.0f, -64.89f),
-            /* 17 (Road top - 32) */vec3(-96.5f, 0.0f, -920.41f),
-            /* 18 (Road top - 34) */vec3(366.22f, 0.0f, -920.41f),
-            /* 19 (Road top - 35) */vec3(233.2f, 0.0f, -64.89f),
-            // Grass front
-            /* 20 (Grass front - 43) */vec3(-1029.73f, 0.0f, -920.41f),
-            /* 21 (Grass front - 50) */vec3(-1029.73f, -48.1f, -920.41f),
-            /* 22 (Grass front - 58) */vec3(880.5f, 0.0f, -920.41f),
-            /* 23 (Grass front - 59) */vec3(880.5f, -48.1f, -920.41f),
-            // Grass right
-            /* 24 (Grass right - 58) */vec3(880.5f, 0.0f, -920.41f),
-            /* 25 (Grass right - 59) */vec3(880.5f, -48.1f, -920.41f),
-            /* 26 (Grass right - 64) */vec3(880.5f, 0.0f, 918.24f),
-            /* 27 (Grass right - 66) */vec3(880.5f, -48.1f, 918.24f),
-            // Grass back
-            /* 28 (Grass back - 64) */vec3(880.5f, 0.0f, 918.24f),
-            /* 29 (Grass back - 65) */vec3(-1029.73f, 0.0f, 918.24f),
-            /* 30 (Grass back - 66) */vec3(880.5f, -48.1f, 918.24f),
-            /* 31 (Grass back - 67) */vec3(-1029.73f, -48.1f, 918.24f),
-            // Grass left
-            /* 32 (Grass left - 43) */vec3(-1029.73f, 0.0f, -920.41f),
-            /* 33 (Grass left - 50) */vec3(-1029.73f, -48.1f, -920.41f),
-            /* 34 (Grass left - 65) */vec3(-1029.73f, 0.0f, 918.24f),
-            /* 35 (Grass left - 67) */vec3(-1029.73f, -48.1f, 918.24f),
-            // Grass bottom
-            /* 36 (Grass bottom - 50) */vec3(-1029.73f, -48.1f, -920.41f),
-            /* 37 (Grass bottom - 59) */vec3(880.5f, -48.1f, -920.41f),
-            /* 38 (Grass bottom - 66) */vec3(880.5f, -48.1f, 918.24f),
-            /* 39 (Grass bottom - 67) */vec3(-1029.73f, -48.1f, 918.24f),
-            // House front
-            /* 40 (House front - 50) */vec3(149.63f, 848.02f, -64.89f),
-            /* 41 (House front - 51) */vec3(62.39f, 678.83f, -64.89f),
-            /* 42 (House front - 54) */vec3(62.39f, 453.65f, -64.89f),
-            /* 43 (House front - 56) */vec3(31.46f, 316.43f, -64.89f),
-            /* 44 (House front - 58) */vec3(31.46f, 0.0f, -64.89f),
-            /* 45 (House front - 59) */vec3(223.28f, 678.83f, -64.89f),
-            /* 46 (House front - 81) */vec3(-224.47f, 466.78f, -64.89f),
-            /* 47 (House front - 62) */vec3(483.08f, 464.99f, -64.89f),
-            /* 48 (House front - 63) */vec3(249.36f, 316.43f, -64.89f),
-            /* 49 (House front - 64) */vec3(249.36f, 0.0f, -64.89f),
-            /* 50 (House front - 65) */vec3(483.08f, 0.0f, -64.89f),
-            /* 51 (House front - 79) */vec3(-224.47f, 0.0f, -64.89f),
-            /* 52 (House front - 55) */vec3(223.28f, 453.65f, -64.89f),
-            // House right
-            /* 53 (House right - 27) */vec3(483.08f, 464.99f, 636.31f),
-            /* 54 (House right - 29) */vec3(483.08f, 0.0f, 636.31f),
-            /* 55 (House right - 62) */vec3(483.08f, 464.99f, -64.89f),
-            /* 56 (House right - 65) */vec3(483.08f, 0.0f, -64.89f),
-            // House back
-            /* 57 (House back - 27) */vec3(483.08f, 464.99f, 636.31f),
-            /* 58 (House back - 29) */vec3(483.08f, 0.0f, 636.31f),
-            /* 59 (House back - 30) */vec3(149.63f, 848.02f, 636.31f),
-            /* 60 (House back - 74) */vec3(-224.47f, 466.78f, 636.31f),
-            /* 61 (House back - 76) */vec3(-224.47f, 0.0f, 636.31f),
-            // House left
-            /* 62 (House left - 74) */vec3(-224.47f, 466.78f, 636.31f),
-            /* 63 (House left - 76) */vec3(-224.47f, 0.0f, 636.31f),
-            /* 64 (House left - 79) */vec3(-224.47f, 0.0f, -64.89f),
-            /* 65 (House left - 81) */vec3(-224.47f, 466.78f, -64.89f),
-            // Door
-            /* 66 (Door - 4) */vec3(47.62f, 300.27f, -40.76f),
-            /* 67 (Door - 5) */vec3(233.2f, 300.27f, -40.76f),
-            /* 68 (Door - 6) */vec3(47.62f, 0.0f, -40.76f),
-            /* 69 (Door - 7) */vec3(233.2f, 0.0f, -40.76f),
-            // Door frame - front
-            /* 70 (Door frame - front - 23) */vec3(249.36f, 0.0f, -77.59f),
-            /* 71 (Door frame - front - 29) */vec3(249.36f, 316.43f, -77.59f),
-            /* 72 (Door frame - front - 38) */vec3(31.46f, 0.0f, -77.59f),
-            /* 73 (Door frame - front - 39) */vec3(31.46f, 316.43f, -77.59f),
-            /* 74 (Door frame - front - 46) */vec3(47.62f, 300.27f, -77.59f),
-            /* 75 (Door frame - front - 47) */vec3(47.62f, 0.0f, -77.59f),
-            /* 76 (Door frame - front - 54) */vec3(233.2f, 0.0f, -77.59f),
-            /* 77 (Door frame - front - 55) */vec3(233.2f, 300.27f, -77.59f),
-            // Door frame - top
-            /* 78 (Door frame - top - 28) */vec3(249.36f, 316.43f, -64.89f),
-            /* 79 (Door frame - top - 29) */vec3(249.36f, 316.43f, -77.59f),
-            /* 80 (Door frame - top - 37) */vec3(31.46f, 316.43f, -64.89f),
-            /* 81 (Door frame - top - 39) */vec3(31.46f, 316.43f, -77.59f),
-            // Door frame - left
-            /* 82 (Door frame - left - 36) */vec3(31.46f, 0.0f, -64.89f),
-            /* 83 (Door frame - left - 37) */vec3(31.46f, 316.43f, -64.89f),
-            /* 84 (Door frame - left - 38) */vec3(31.46f, 0.0f, -77.59f),
-            /* 85 (Door frame - left - 39) */vec3(31.46f, 316.43f, -77.59f),
-            /* 86 (Door frame - left - 52) */vec3(233.2f, 0.0f, -40.76f),
-            /* 87 (Door frame - left - 53) */vec3(233.2f, 300.27f, -40.76f),
-            /* 88 (Door frame - left - 54) */vec3(233.2f, 0.0f, -77.59f),
-            /* 89 (Door frame - left - 55) */vec3(233.2f, 300.27f, -77.59f),
-            // Door frame - right
-            /* 90 (Door frame - right - 21) */vec3(249.36f, 0.0f, -64.89f),
-            /* 91 (Door frame - right - 23) */vec3(249.36f, 0.0f, -77.59f),
-            /* 92 (Door frame - right - 28) */vec3(249.36f, 316.43f, -64.89f),
-            /* 93 (Door frame - right - 29) */vec3(249.36f, 316.43f, -77.59f),
-            /* 94 (Door frame - right - 44) */vec3(47.62f, 300.27f, -40.76f),
-            /* 95 (Door frame - right - 45) */vec3(47.62f, 0.0f, -40.76f),
-            /* 96 (Door frame - right - 46) */vec3(47.62f, 300.27f, -77.59f),
-            /* 97 (Door frame - right - 47) */vec3(47.62f, 0.0f, -77.59f),
-            // Door frame - top
-            /* 98 (Door frame - top - 44) */vec3(47.62f, 300.27f, -40.76f),
-            /* 99 (Door frame - top - 46) */vec3(47.62f, 300.27f, -77.59f),
-            /* 100 (Door frame - top - 53) */vec3(233.2f, 300.27f, -40.76f),
-            /* 101 (Door frame - top - 55) */vec3(233.2f, 300.27f, -77.59f),
-            // Window - bottom left
-            /* 102 (Window - bottom left - 4) */vec3(75.52f, 559.77f, -40.76f),
-            /* 103 (Window - bottom left - 5) */vec3(135.49f, 559.77f, -40.76f),
-            /* 104 (Window - bottom left - 6) */vec3(75.52f, 466.78f, -40.76f),
-            /* 105 (Window - bottom left - 7) */vec3(135.49f, 466.78f, -40.76f),
-            // Window - bottom right
-            /* 106 (Window - bottom right - 4) */vec3(150.1f, 559.77f, -40.76f),
-            /* 107 (Window - bottom right - 5) */vec3(210.14f, 559.77f, -40.76f),
-            /* 108 (Window - bottom right - 6) */vec3(150.1f, 466.78f, -40.76f),
-            /* 109 (Window - bottom right - 7) */vec3(210.14f, 466.78f, -40.76f),
-            // Window - top left
-            /* 110 (Window - top left - 4) */vec3(75.52f, 665.7f, -40.76f),
-            /* 111 (Window - top left - 5) */vec3(135.49f, 665.7f, -40.76f),
-            /* 112 (Window - top left - 6) */vec3(75.52f, 572.41f, -40.76f),
-            /* 113 (Window - top left - 7) */vec3(135.49f, 572.41f, -40.76f),
-            // Window - top right
-            /* 114 (Window - top right - 4) */vec3(150.1f, 665.7f, -40.76f),
-            /* 115 (Window - top right - 5) */vec3(210.14f, 665.7f, -40.76f),
-            /* 116 (Window - top right - 6) */vec3(150.1f, 572.41f, -40.76f),
-            /* 117 (Window - top right - 7) */vec3(210.14f, 572.41f, -40.76f),
-            // Window - inner frame - front
-            /* 118 (Window - inner frame - front - 37) */vec3(150.1f, 559.77f, -59.17f),
-            /* 119 (Window - inner frame - front - 39) */vec3(150.1f, 466.78f, -59.17f),
-            /* 120 (Window - inner frame - front - 54) */vec3(135.49f, 466.78f, -59.17f),
-            /* 121 (Window - inner frame - front - 55) */vec3(135.49f, 559.77f, -59.17f),
-            /* 122 (Window - inner frame - front - 66) */vec3(75.52f, 559.77f, -59.17f),
-            /* 123 (Window - inner frame - front - 81) */vec3(210.14f, 559.77f, -59.17f),
-            /* 124 (Window - inner frame - front - 93) */vec3(210.14f, 572.41f, -59.17f),
-            /* 125 (Window - inner frame - front - 102) */vec3(150.1f, 665.7f, -59.17f),
-            /* 126 (Window - inner frame - front - 103) */vec3(150.1f, 572.41f, -59.17f),
-            /* 127 (Window - inner frame - front - 111) */vec3(135.49f, 665.7f, -59.17f),
-            /* 128 (Window - inner frame - front - 117) */vec3(135.49f, 572.41f, -59.17f),
-            /* 129 (Window - inner frame - front - 119) */vec3(75.52f, 572.41f, -59.17f),
-            // Window - inner frame - bottom
-            /* 130 (Window - inner frame - bottom - 21) */vec3(150.1f, 466.78f, -40.76f),
-            /* 131 (Window - inner frame - bottom - 39) */vec3(150.1f, 466.78f, -59.17f),
-            /* 132 (Window - inner frame - bottom - 52) */vec3(135.49f, 466.78f, -40.76f),
-            /* 133 (Window - inner frame - bottom - 54) */vec3(135.49f, 466.78f, -59.17f),
-            /* 134 (Window - inner frame - bottom - 65) */vec3(75.52f, 466.78f, -40.76f),
-            /* 135 (Window - inner frame - bottom - 67) */vec3(75.52f, 466.78f, -77.59f),
-            /* 136 (Window - inner frame - bottom - 82) */vec3(210.14f, 466.78f, -40.76f),
-            /* 137 (Window - inner frame - bottom - 84) */vec3(210.14f, 466.78f, -77.59f),
-            /* 138 (Window - inner frame - bottom - 92) */vec3(210.14f, 572.41f, -40.76f),
-            /* 139 (Window - inner frame - bottom - 93) */vec3(210.14f, 572.41f, -59.17f),
-            /* 140 (Window - inner frame - bottom - 101) */vec3(150.1f, 572.41f, -40.76f),
-            /* 141 (Window - inner frame - bottom - 103) */vec3(150.1f, 572.41f, -59.17f),
-            /* 142 (Window - inner frame - bottom - 116) */vec3(135.49f, 572.41f, -40.76f),
-            /* 143 (Window - inner frame - bottom - 117) */vec3(135.49f, 572.41f, -59.17f),
-            /* 144 (Window - inner frame - bottom - 118) */vec3(75.52f, 572.41f, -40.76f),
-            /* 145 (Window - inner frame - bottom - 119) */vec3(75.52f, 572.41f, -59.17f),
-            // Window - inner frame - left
-            /* 146 (Window - inner frame - left - 20) */vec3(150.1f, 559.77f, -40.76f),
-            /* 147 (Window - inner frame - left - 21) */vec3(150.1f, 466.78f, -40.76f),
-            /* 148 (Window - inner frame - left - 37) */vec3(150.1f, 559.77f, -59.17f),
-            /* 149 (Window - inner frame - left - 39) */vec3(150.1f, 466.78f, -59.17f),
-            /* 150 (Window - inner frame - left - 64) */vec3(75.52f, 559.77f, -40.76f),
-            /* 151 (Window - inner frame - left - 65) */vec3(75.52f, 466.78f, -40.76f),
-            /* 152 (Window - inner frame - left - 66) */vec3(75.52f, 559.77f, -59.17f),
-            /* 153 (Window - inner frame - left - 67) */vec3(75.52f, 466.78f, -77.59f),
-            /* 154 (Window - inner frame - left - 68) */vec3(75.52f, 665.7f, -77.59f),
-            /* 155 (Window - inner frame - left - 71) */vec3(75.52f, 665.7f, -40.76f),
-            /* 156 (Window - inner frame - left - 100) */vec3(150.1f, 665.7f, -40.76f),
-            /* 157 (Window - inner frame - left - 101) */vec3(150.1f, 572.41f, -40.76f),
-            /* 158 (Window - inner frame - left - 102) */vec3(150.1f, 665.7f, -59.17f),
-            /* 159 (Window - inner frame - left - 103) */vec3(150.1f, 572.41f, -59.17f),
-            /* 160 (Window - inner frame - left - 118) */vec3(75.52f, 572.41f, -40.76f),
-            /* 161 (Window - inner frame - left - 119) */vec3(75.52f, 572.41f, -59.17f),
-            // Window - inner frame - right
-            /* 162 (Window - inner frame - right - 52) */vec3(135.49f, 466.78f, -40.76f),
-            /* 163 (Window - inner frame - right - 53) */vec3(135.49f, 559.77f, -40.76f),
-            /* 164 (Window - inner frame - right - 54) */vec3(135.49f, 466.78f, -59.17f),
-            /* 165 (Window - inner frame - right - 55) */vec3(135.49f, 559.77f, -59.17f),
-            /* 166 (Window - inner frame - right - 80) */vec3(210.14f, 559.77f, -40.76f),
-            /* 167 (Window - inner frame - right - 81) */vec3(210.14f, 559.77f, -59.17f),
-            /* 168 (Window - inner frame - right - 82) */vec3(210.14f, 466.78f, -40.76f),
-            /* 169 (Window - inner frame - right - 84) */vec3(210.14f, 466.78f, -77.59f),
-            /* 170 (Window - inner frame - right - 86) */vec3(210.14f, 665.7f, -40.76f),
-            /* 171 (Window - inner frame - right - 87) */vec3(210.14f, 665.7f, -77.59f),
-            /* 172 (Window - inner frame - right - 92) */vec3(210.14f, 572.41f, -40.76f),
-            /* 173 (Window - inner frame - right - 93) */vec3(210.14f, 572.41f, -59.17f),
-            /* 174 (Window - inner frame - right - 109) */vec3(135.49f, 665.7f, -40.76f),
-            /* 175 (Window - inner frame - right - 111) */vec3(135.49f, 665.7f, -59.17f),
-            /* 176 (Window - inner frame - right - 116) */vec3(135.49f, 572.41f, -40.76f),
-            /* 177 (Window - inner frame - right - 117) */vec3(135.49f, 572.41f, -59.17f),
-            // Window - outer frame - front
-            /* 178 (Window - outer frame - front - 9) */vec3(75.52f, 665.7f, -77.59f),
-            /* 179 (Window - outer frame - front - 11) */vec3(75.52f, 466.78f, -77.59f),
-            /* 180 (Window - outer frame - front - 12) */vec3(210.14f, 466.78f, -77.59f),
-            /* 181 (Window - outer frame - front - 14) */vec3(210.14f, 665.7f, -77.59f),
-            /* 182 (Window - outer frame - front - 22) */vec3(62.39f, 453.65f, -77.59f),
-            /* 183 (Window - outer frame - front - 31) */vec3(223.28f, 453.65f, -77.59f),
-            /* 184 (Window - outer frame - front - 37) */vec3(223.28f, 678.83f, -77.59f),
-            /* 185 (Window - outer frame - front - 39) */vec3(62.39f, 678.83f, -77.59f),
-            // Window - inner frame - top
-            /* 186 (Window - inner frame - top - 8) */vec3(210.14f, 665.7f, -40.76f),
-            /* 187 (Window - inner frame - top - 9) */vec3(150.1f, 665.7f, -59.17f),
-            /* 188 (Window - inner frame - top - 10) */vec3(210.14f, 665.7f, -77.59f),
-            /* 189 (Window - inner frame - top - 11) */vec3(135.49f, 665.7f, -59.17f),
-            /* 190 (Window - inner frame - top - 12) */vec3(75.52f, 665.7f, -77.59f),
-            /* 191 (Window - inner frame - top - 13) */vec3(135.49f, 665.7f, -40.76f),
-            /* 192 (Window - inner frame - top - 14) */vec3(75.52f, 665.7f, -40.76f),
-            /* 193 (Window - inner frame - top - 15) */vec3(150.1f, 665.7f, -40.76f),
-            // Window - inner frame - bottom - left
-            /* 194 (Window - inner frame - bottom - left - 4) */vec3(135.49f, 559.77f, -59.17f),
-            /* 195 (Window - inner frame - bottom - left - 5) */vec3(135.49f, 559.77f, -40.76f),
-            /* 196 (Window - inner frame - bottom - left - 6) */vec3(75.52f, 559.77f, -59.17f),
-            /* 197 (Window - inner frame - bottom - left - 7) */vec3(75.52f, 559.77f, -40.76f),
-            // Window - inner frame - bottom - right
-            /* 198 (Window - inner frame - bottom - right - 4) */vec3(210.14f, 559.77f, -59.17f),
-            /* 199 (Window - inner frame - bottom - right - 5) */vec3(210.14f, 559.77f, -40.76f),
-            /* 200 (Window - inner frame - bottom - right - 6) */vec3(150.1f, 559.77f, -59.17f),
-            /* 201 (Window - inner frame - bottom - right - 7) */vec3(150.1f, 559.77f, -40.76f),
-            // Window - outer frame - bottom & top
-            /* 202 (Window - outer frame - bottom & top - 20) */vec3(62.39f, 453.65f, -64.89f),
-            /* 203 (Window - outer frame - bottom & top - 22) */vec3(62.39f, 453.65f, -77.59f),
-            /* 204 (Window - outer frame - bottom & top - 29) */vec3(223.28f, 453.65f, -64.89f),
-            /* 205 (Window - outer frame - bottom & top - 31) */vec3(223.28f, 453.65f, -77.59f),
-            /* 206 (Window - outer frame - bottom & top - 36) */vec3(223.28f, 678.83f, -64.89f),
-            /* 207 (Window - outer frame - bottom & top - 37) */vec3(223.28f, 678.83f, -77.59f),
-            /* 208 (Window - outer frame - bottom & top - 38) */vec3(62.39f, 678.83f, -64.89f),
-            /* 209 (Window - outer frame - bottom & top - 39) */vec3(62.39f, 678.83f, -77.59f),
-            // Window - outer frame - left & right
-            /* 210 (Window - outer frame - left & right - 20) */vec3(62.39f, 453.65f, -64.89f),
-            /* 211 (Window - outer frame - left & right - 22) */vec3(62.39f, 453.65f, -77.59f),
-            /* 212 (Window - outer frame - left & right - 29) */vec3(223.28f, 453.65f, -64.89f),
-            /* 213 (Window - outer frame - left & right - 31) */vec3(223.28f, 453.65f, -77.59f),
-            /* 214 (Window - outer frame - left & right - 36) */vec3(223.28f, 678.83f, -64.89f),
-            /* 215 (Window - outer frame - left & right - 37) */vec3(223.28f, 678.83f, -77.59f),
-            /* 216 (Window - outer frame - left & right - 38) */vec3(62.39f, 678.83f, -64.89f),
-            /* 217 (Window - outer frame - left & right - 39) */vec3(62.39f, 678.83f, -77.59f),
-            // Roof - left slope top
-            /* 218 (Roof - left slope top - 133) */vec3(150.46f, 875.79f, 678.86f),
-            /* 219 (Roof - left slope top - 135) */vec3(150.46f, 875.79f, -115.21f),
-            /* 220 (Roof - left slope top - 162) */vec3(-291.43f, 425.47f, 678.86f),
-            /* 221 (Roof - left slope top - 164) */vec3(-291.43f, 425.47f, -115.21f),
-            // Roof - right slope top
-            /* 222 (Roof - right slope top - 59) */vec3(547.33f, 425.47f, 678.86f),
-            /* 223 (Roof - right slope top - 61) */vec3(547.33f, 425.47f, -115.21f),
-            /* 224 (Roof - right slope top - 133) */vec3(150.46f, 875.79f, 678.86f),
-            /* 225 (Roof - right slope top - 135) */vec3(150.46f, 875.79f, -115.21f),
-            // Roof - left slope bottom
-            /* 226 (Roof - left slope bottom - 78) */vec3(149.63f, 848.02f, 636.31f),
-            /* 227 (Roof - left slope bottom - 85) */vec3(149.63f, 848.02f, 678.86f),
-            /* 228 (Roof - left slope bottom - 108) */vec3(149.63f, 848.02f, -64.89f),
-            /* 229 (Roof - left slope bottom - 110) */vec3(149.63f, 848.02f, -115.21f),
-            /* 230 (Roof - left slope bottom - 118) */vec3(-224.47f, 466.78f, 678.86f),
-            /* 231 (Roof - left slope bottom - 120) */vec3(-224.47f, 466.78f, 636.31f),
-            /* 232 (Roof - left slope bottom - 143) */vec3(-224.47f, 466.78f, -64.89f),
-            /* 233 (Roof - left slope bottom - 145) */vec3(-224.47f, 466.78f, -115.21f),
-            /* 234 (Roof - left slope bottom - 154) */vec3(-265.01f, 425.47f, -115.21f),
-            /* 235 (Roof - left slope bottom - 155) */vec3(-265.01f, 425.47f, 678.86f),
-            // Roof - right slope bottom
-            /* 236 (Roof - right slope bottom - 26) */vec3(517.49f, 425.47f, -115.21f),
-            /* 237 (Roof - right slope bottom - 35) */vec3(483.08f, 464.99f, -64.89f),
-            /* 238 (Roof - right slope bottom - 36) */vec3(483.08f, 464.99f, -115.21f),
-            /* 239 (Roof - right slope bottom - 44) */vec3(483.08f, 464.99f, 636.31f),
-            /* 240 (Roof - right slope bottom - 51) */vec3(483.08f, 464.99f, 678.86f),
-            /* 241 (Roof - right slope bottom - 53) */vec3(517.49f, 425.47f, 678.86f),
-            /* 242 (Roof - right slope bottom - 78) */vec3(149.63f, 848.02f, 636.31f),
-            /* 243 (Roof - right slope bottom - 85) */vec3(149.63f, 848.02f, 678.86f),
-            /* 244 (Roof - right slope bottom - 108) */vec3(149.63f, 848.02f, -64.89f),
-            /* 245 (Roof - right slope bottom - 110) */vec3(149.63f, 848.02f, -115.21f),
-            // Roof - front
-            /* 246 (Roof - front - 26) */vec3(517.49f, 425.47f, -115.21f),
-            /* 247 (Roof - front - 61) */vec3(547.33f, 425.47f, -115.21f),
-            /* 248 (Roof - front - 110) */vec3(149.63f, 848.02f, -115.21f),
-            /* 249 (Roof - front - 135) */vec3(150.46f, 875.79f, -115.21f),
-            /* 250 (Roof - front - 154) */vec3(-265.01f, 425.47f, -115.21f),
-            /* 251 (Roof - front - 164) */vec3(-291.43f, 425.47f, -115.21f),
-            // Roof - back
-            /* 252 (Roof - back - 53) */vec3(517.49f, 425.47f, 678.86f),
-            /* 253 (Roof - back - 59) */vec3(547.33f, 425.47f, 678.86f),
-            /* 254 (Roof - back - 85) */vec3(149.63f, 848.02f, 678.86f),
-            /* 255 (Roof - back - 133) */vec3(150.46f, 875.79f, 678.86f),
-            /* 256 (Roof - back - 155) */vec3(-265.01f, 425.47f, 678.86f),
-            /* 257 (Roof - back - 162) */vec3(-291.43f, 425.47f, 678.86f),
-            // Roof - bottom
-            /* 258 (Roof - bottom - 26) */vec3(517.49f, 425.47f, -115.21f),
-            /* 259 (Roof - bottom - 53) */vec3(517.49f, 425.47f, 678.86f),
-            /* 260 (Roof - bottom - 59) */vec3(547.33f, 425.47f, 678.86f),
-            /* 261 (Roof - bottom - 61) */vec3(547.33f, 425.47f, -115.21f),
-            /* 262 (Roof - bottom - 154) */vec3(-265.01f, 425.47f, -115.21f),
-            /* 263 (Roof - bottom - 155) */vec3(-265.01f, 425.47f, 678.86f),
-            /* 264 (Roof - bottom - 162) */vec3(-291.43f, 425.47f, 678.86f),
-            /* 265 (Roof - bottom - 164) */vec3(-291.43f, 425.47f, -115.21f),
-            // Chimney - outer - front & back
-            /* 266 (Chimney - outer - front & back - 22) */vec3(308.14f, 467.57f, 174.61f),
-            /* 267 (Chimney - outer - front & back - 31) */vec3(308.14f, 467.57f, 424.14f),
-            /* 268 (Chimney - outer - front & back - 37) */vec3(462.36f, 467.57f, 424.14f),
-            /* 269 (Chimney - outer - front & back - 39) */vec3(462.36f, 467.57f, 174.61f),
-            /* 270 (Chimney - outer - front & back - 48) */vec3(462.36f, 875.79f, 174.61f),
-            /* 271 (Chimney - outer - front & back - 50) */vec3(462.36f, 875.79f, 424.14f),
-            /* 272 (Chimney - outer - front & back - 53) */vec3(308.14f, 875.79f, 424.14f),
-            /* 273 (Chimney - outer - front & back - 55) */vec3(308.14f, 875.79f, 174.61f),
-            // Chimney - outer - left & right
-            /* 274 (Chimney - outer - left & right - 22) */vec3(308.14f, 467.57f, 174.61f),
-            /* 275 (Chimney - outer - left & right - 31) */vec3(308.14f, 467.57f, 424.14f),
-            /* 276 (Chimney - outer - left & right - 37) */vec3(462.36f, 467.57f, 424.14f),
-            /* 277 (Chimney - outer - left & right - 39) */vec3(462.36f, 467.57f, 174.61f),
-            /* 278 (Chimney - outer - left & right - 48) */vec3(462.36f, 875.79f, 174.61f),
-            /* 279 (Chimney - outer - left & right - 50) */vec3(462.36f, 875.79f, 424.14f),
-            /* 280 (Chimney - outer - left & right - 53) */vec3(308.14f, 875.79f, 424.14f),
-            /* 281 (Chimney - outer - left & right - 55) */vec3(308.14f, 875.79f, 174.61f),
-            // Chimney - outer - top
-            /* 282 (Chimney - outer - top - 48) */vec3(462.36f, 875.79f, 174.61f),
-            /* 283 (Chimney - outer - top - 49) */vec3(434.47f, 875.79f, 396.25f),
-            /* 284 (Chimney - outer - top - 50) */vec3(462.36f, 875.79f, 424.14f),
-            /* 285 (Chimney - outer - top - 51) */vec3(336.04f, 875.79f, 396.25f),
-            /* 286 (Chimney - outer - top - 52) */vec3(336.04f, 875.79f, 202.51f),
-            /* 287 (Chimney - outer - top - 53) */vec3(308.14f, 875.79f, 424.14f),
-            /* 288 (Chimney - outer - top - 54) */vec3(434.47f, 875.79f, 202.51f),
-            /* 289 (Chimney - outer - top - 55) */vec3(308.14f, 875.79f, 174.61f),
-            // Chimney - inner - top
-            /* 290 (Chimney - inner - top - 4) */vec3(434.47f, 853.6f, 396.25f),
-            /* 291 (Chimney - inner - top - 5) */vec3(434.47f, 853.6f, 202.51f),
-            /* 292 (Chimney - inner - top - 6) */vec3(336.04f, 853.6f, 396.25f),
-            /* 293 (Chimney - inner - top - 7) */vec3(336.04f, 853.6f, 202.51f),
-    };
-    const vector<vec3> colors = {
-            // Grass
-            vec3(Constants::COLOR_GRASS.r, Constants::COLOR_GRASS.g, Constants::COLOR_GRASS.b),
-            vec3(Constants::COLOR_GRASS.r, Constants::COLOR_GRASS.g, Constants::COLOR_GRASS.b),
-            vec3(Constants::COLOR_GRASS.r, Constants::COLOR_GRASS.g, Constants::COLOR_GRASS.b),
-            vec3(Constants::COLOR_GRASS.r, Constants::COLOR_GRASS.g, Constants::COLOR_GRASS.b),
-            vec3(Constants::COLOR_GRASS.r, Constants::COLOR_GRASS.g, Constants::COLOR_GRASS.b),
-            vec3(Constants::COLOR_GRASS.r, Constants::COLOR_GRASS.g, Constants::COLOR_GRASS.b),
-            vec3(Constants::COLOR_GRASS.r, Constants::COLOR_GRASS.g, Constants::COLOR_GRASS.b),
-            vec3(Constants::COLOR_GRASS.r, Constants::COLOR_GRASS.g, Constants::COLOR_GRASS.b),
-            vec3(Constants::COLOR_GRASS.r, Constants::COLOR_GRASS.g, Constants::COLOR_GRASS.b),
-            vec3(Constants::COLOR_GRASS.r, Constants::COLOR_GRASS.g, Constants::COLOR_GRASS.b),
-            vec3(Constants::COLOR_GRASS.r, Constants::COLOR_GRASS.g, Constants::COLOR_GRASS.b),
-            vec3(Constants::COLOR_GRASS.r, Constants::COLOR_GRASS.g, Constants::COLOR_GRASS.b),
-            vec3(Constants::COLOR_ROAD.r, Constants::COLOR_ROAD.g, Constants::COLOR_ROAD.b),
-            vec3(Constants::COLOR_ROAD.r, Constants::COLOR_ROAD.g, Constants::COLOR_ROAD.b),
-            vec3(Constants::COLOR_ROAD.r, Constants::COLOR_ROAD.g, Constants::COLOR_ROAD.b),
-            vec3(Constants::COLOR_ROAD.r, Constants::COLOR_ROAD.g, Constants::COLOR_ROAD.b),
-            vec3(Constants::COLOR_ROAD.r, Constants::COLOR_ROAD.g, Constants::COLOR_ROAD.b),
-            vec3(Constants::COLOR_ROAD.r, Constants::COLOR_ROAD.g, Constants::COLOR_ROAD.b),
-            vec3(Constants::COLOR_ROAD.r, Constants::COLOR_ROAD.g, Constants::COLOR_ROAD.b),
-            vec3(Constants::COLOR_ROAD.r, Constants::COLOR_ROAD.g, Constants::COLOR_ROAD.b),
-            vec3(Constants::COLOR_GRASS.r, Constants::COLOR_GRASS.g, Constants::COLOR_GRASS.b),
-            vec3(Constants::COLOR_GRASS.r, Constants::COLOR_GRASS.g, Constants::COLOR_GRASS.b),
-            vec3(Constants::COLOR_GRASS.r, Constants::COLOR_GRASS.g, Constants::COLOR_GRASS.b),
-            vec3(Constants::COLOR_GRASS.r, Constants::COLOR_GRASS.g, Constants::COLOR_GRASS.b),
-            vec3(Constants::COLOR_GRASS.r, Constants::COLOR_GRASS.g, Constants::COLOR_GRASS.b),
-            vec3(Constants::COLOR_GRASS.r, Constants::COLOR_GRASS.g, Constants::COLOR_GRASS.b),
-            vec3(Constants::COLOR_GRASS.r, Constants::COLOR_GRASS.g, Constants::COLOR_GRASS.b),
-            vec3(Constants::COLOR_GRASS.r, Constants::COLOR_GRASS.g, Constants::COLOR_GRASS.b),
-            vec3(Constants::COLOR_GRASS.r, Constants::COLOR_GRASS.g, Constants::COLOR_GRASS.b),
-            vec3(Constants::COLOR_GRASS.r, Constants::COLOR_GRASS.g, Constants::COLOR_GRASS.b),
-            vec3(Constants::COLOR_GRASS.r, Constants::COLOR_GRASS.g, Constants::COLOR_GRASS.b),
-            vec3(Constants::COLOR_GRASS.r, Constants::COLOR_GRASS.g, Constants::COLOR_GRASS.b),
-            vec3(Constants::COLOR_GRASS.r, Constants::COLOR_GRASS.g, Constants::COLOR_GRASS.b),
-            vec3(Constants::COLOR_GRASS.r, Constants::COLOR_GRASS.g, Constants::COLOR_GRASS.b),
-            vec3(Constants::COLOR_GRASS.r, Constants::COLOR_GRASS.g, Constants::COLOR_GRASS.b),
-            vec3(Constants::COLOR_GRASS.r, Constants::COLOR_GRASS.g, Constants::COLOR_GRASS.b),
-            vec3(Constants::COLOR_GRASS.r, Constants::COLOR_GRASS.g, Constants::COLOR_GRASS.b),
-            vec3(Constants::COLOR_GRASS.r, Constants::COLOR_GRASS.g, Constants::COLOR_GRASS.b),
-            vec3(Constants::COLOR_GRASS.r, Constants::COLOR_GRASS.g, Constants::COLOR_GRASS.b),
-            vec3(Constants::COLOR_GRASS.r, Constants::COLOR_GRASS.g, Constants::COLOR_GRASS.b),
-            vec3(Constants::COLOR_WALLS.r, Constants::COLOR_WALLS.g, Constants::COLOR_WALLS.b),
-            vec3(Constants::COLOR_WALLS.r, Constants::COLOR_WALLS.g, Constants::COLOR_WALLS.b),
-            vec3(Constants::COLOR_WALLS.r, Constants::COLOR_WALLS.g, Constants::COLOR_WALLS.b),
-            vec3(Constants::COLOR_WALLS.r, Constants::COLOR_WALLS.g, Constants::COLOR_WALLS.b),
-            vec3(Constants::COLOR_WALLS.r, Constants::COLOR_WALLS.g, Constants::COLOR_WALLS.b),
-            vec3(Constants::COLOR_WALLS.r, Constants::COLOR_WALLS.g, Constants::COLOR_WALLS.b),
-            vec3(Constants::COLOR_WALLS.r, Constants::COLOR_WALLS.g, Constants::COLOR_WALLS.b),
-            vec3(Constants::COLOR_WALLS.r, Constants::COLOR_WALLS.g, Constants::COLOR_WALLS.b),
-            vec3(Constants::COLOR_WALLS.r, Constants::COLOR_WALLS.g, Constants::COLOR_WALLS.b),
-            vec3(Constants::COLOR_WALLS.r, Constants::COLOR_WALLS.g, Constants::COLOR_WALLS.b),
-            vec3(Constants::COLOR_WALLS.r, Constants::COLOR_WALLS.g, Constants::COLOR_WALLS.b),
-            vec3(Constants::COLOR_WALLS.r, Constants::COLOR_WALLS.g, Constants::COLOR_WALLS.b),
-            vec3(Constants::COLOR_WALLS.r, Constants::COLOR_WALLS.g, Constants::COLOR_WALLS.b),
-            vec3(Constants::COLOR_WALLS.r, Constants::COLOR_WALLS.g, Constants::COLOR_WALLS.b),
-            vec3(Constants::COLOR_WALLS.r, Constants::COLOR_WALLS.g, Constants::COLOR_WALLS.b),
-            vec3(Constants::COLOR_WALLS.r, Constants::COLOR_WALLS.g, Constants::COLOR_WALLS.b),
-            vec3(Constants::COLOR_WALLS.r, Constants::COLOR_WALLS.g, Constants::COLOR_WALLS.b),
-            vec3(Constants::COLOR_WALLS.r, Constants::COLOR_WALLS.g, Constants::COLOR_WALLS.b),
-            vec3(Constants::COLOR_WALLS.r, Constants::COLOR_WALLS.g, Constants::COLOR_WALLS.b),
-            vec3(Constants::COLOR_WALLS.r, Constants::COLOR_WALLS.g, Constants::COLOR_WALLS.b),
-            vec3(Constants::COLOR_WALLS.r, Constants::COLOR_WALLS.g, Constants::COLOR_WALLS.b),
-            vec3(Constants::COLOR_WALLS.r, Constants::COLOR_WALLS.g, Constants::COLOR_WALLS.b),
-            vec3(Constants::COLOR_WALLS.r, Constants::COLOR_WALLS.g, Constants::COLOR_WALLS.b),
-            vec3(Constants::COLOR_WALLS.r, Constants::COLOR_WALLS.g, Constants::COLOR_WALLS.b),
-            vec3(Constants::COLOR_WALLS.r, Constants::COLOR_WALLS.g, Constants::COLOR_WALLS.b),
-            vec3(Constants::COLOR_WALLS.r, Constants::COLOR_WALLS.g, Constants::COLOR_WALLS.b),
-            vec3(Constants::COLOR_DOOR.r, Constants::COLOR_DOOR.g, Constants::COLOR_DOOR.b),
-            vec3(Constants::COLOR_DOOR.r, Constants::COLOR_DOOR.g, Constants::COLOR_DOOR.b),
-            vec3(Constants::COLOR_DOOR.r, Constants::COLOR_DOOR.g, Constants::COLOR_DOOR.b),
-            vec3(Constants::COLOR_DOOR.r, Constants::COLOR_DOOR.g, Constants::COLOR_DOOR.b),
-            vec3(Constants::COLOR_FRAMES.r, Constants::COLOR_FRAMES.g, Constants::COLOR_FRAMES.b),
-            vec3(Constants::COLOR_FRAMES.r, Constants::COLOR_FRAMES.g, Constants::COLOR_FRAMES.b),
-            vec3(Constants::COLOR_FRAMES.r, Constants::COLOR_FRAMES.g, Constants::COLOR_FRAMES.b),
-            vec3(Constants::COLOR_FRAMES.r, Constants::COLOR_FRAMES.g, Constants::COLOR_FRAMES.b),
-            vec3(Constants::COLOR_FRAMES.r, Constants::COLOR_FRAMES.g, Constants::COLOR_FRAMES.b),
-            vec3(Constants::COLOR_FRAMES.r, Constants::COLOR_FRAMES.g, Constants::COLOR_FRAMES.b),
-            vec3(Constants::COLOR_FRAMES.r, Constants::COLOR_FRAMES.g, Constants::COLOR_FRAMES.b),
-            vec3(Constants::COLOR_FRAMES.r, Constants::COLOR_FRAMES.g, Constants::COLOR_FRAMES.b),
-            vec3(Constants::COLOR_FRAMES.r, Constants::COLOR_FRAMES.g, Constants::COLOR_FRAMES.b),
-            vec3(Constants::COLOR_FRAMES.r, Constants::COLOR_FRAMES.g, Constants::COLOR_FRAMES.b),
-            vec3(Constants::COLOR_FRAMES.r, Constants::COLOR_FRAMES.g, Constants::COLOR_FRAMES.b),
-            vec3(Constants::COLOR_FRAMES.r, Constants::COLOR_FRAMES.g, Constants::COLOR_FRAMES.b),
-            vec3(Constants::COLOR_FRAMES.r, Constants::COLOR_FRAMES.g, Constants::COLOR_FRAMES.b),
-            vec3(Constants::COLOR_FRAMES.r, Constants::COLOR_FRAMES.g, Constants::COLOR_FRAMES.b),
-            vec3(Constants::COLOR_FRAMES.r, Constants::COLOR_FRAMES.g, Constants::COLOR_FRAMES.b),
-            vec3(Constants::COLOR_FRAMES.r, Constants::COLOR_FRAMES.g, Constants::COLOR_FRAMES.b),
-            vec3(Constants::COLOR_FRAMES.r, Constants::COLOR_FRAMES.g, Constants::COLOR_FRAMES.b),
-            vec3(Constants::COLOR_FRAMES.r, Constants::COLOR_FRAMES.g, Constants::COLOR_FRAMES.b),
-            vec3(Constants::COLOR_FRAMES.r, Constants::COLOR_FRAMES.g, Constants::COLOR_FRAMES.b),
-            vec3(Constants::COLOR_FRAMES.r, Constants::COLOR_FRAMES.g, Constants::COLOR_FRAMES.b),
-            vec3(Constants::COLOR_FRAMES.r, Constants::COLOR_FRAMES.g, Constants::COLOR_FRAMES.b),
-            vec3(Constants::COLOR_FRAMES.r, Constants::COLOR_FRAMES.g, Constants::COLOR_FRAMES.b),
-            vec3(Constants::COLOR_FRAMES.r, Constants::COLOR_FRAMES.g, Constants::COLOR_FRAMES.b),
-            vec3(Constants::COLOR_FRAMES.r, Constants::COLOR_FRAMES.g, Constants::COLOR_FRAMES.b),
-            vec3(Constants::COLOR_FRAMES.r, Constants::COLOR_FRAMES.g, Constants::COLOR_FRAMES.b),
-            vec3(Constants::COLOR_FRAMES.r, Constants::COLOR_FRAMES.g, Constants::COLOR_FRAMES.b),
-            vec3(Constants::COLOR_FRAMES.r, Constants::COLOR_FRAMES.g, Constants::COLOR_FRAMES.b),
-            vec3(Constants::COLOR_FRAMES.r, Constants::COLOR_FRAMES.g, Constants::COLOR_FRAMES.b),
-            vec3(Constants::COLOR_FRAMES.r, Constants::COLOR_FRAMES.g, Constants::COLOR_FRAMES.b),
-            vec3(Constants::COLOR_FRAMES.r, Constants::COLOR_FRAMES.g, Constants::COLOR_FRAMES.b),
-            vec3(Constants::COLOR_FRAMES.r, Constants::COLOR_FRAMES.g, Constants::COLOR_FRAMES.b),
-            vec3(Constants::COLOR_FRAMES.r, Constants::COLOR_FRAMES.g, Constants::COLOR_FRAMES.b),
-            vec3(Constants::COLOR_WINDOWS.r, Constants::COLOR_WINDOWS.g, Constants::COLOR_WINDOWS.b),
-            vec3(Constants::COLOR_WINDOWS.r, Constants::COLOR_WINDOWS.g, Constants::COLOR_WINDOWS.b),
-            vec3(Constants::COLOR_WINDOWS.r, Constants::COLOR_WINDOWS.g, Constants::COLOR_WINDOWS.b),
-            vec3(Constants::COLOR_WINDOWS.r, Constants::COLOR_WINDOWS.g, Constants::COLOR_WINDOWS.b),
-            vec3(Constants::COLOR_WINDOWS.r, Constants::COLOR_WINDOWS.g, Constants::COLOR_WINDOWS.b),
-            vec3(Constants::COLOR_WINDOWS.r, Constants::COLOR_WINDOWS.g, Constants::COLOR_WINDOWS.b),
-            vec3(Constants::COLOR_WINDOWS.r, Constants::COLOR_WINDOWS.g, Constants::COLOR_WINDOWS.b),
-            vec3(Constants::COLOR_WINDOWS.r, Constants::COLOR_WINDOWS.g, Constants::COLOR_WINDOWS.b),
-            vec3(Constants::COLOR_WINDOWS.r, Constants::COLOR_WINDOWS.g, Constants::COLOR_WINDOWS.b),
-            vec3(Constants::COLOR_WINDOWS.r, Constants::COLOR_WINDOWS.g, Constants::COLOR_WINDOWS.b),
-            vec3(Constants::COLOR_WINDOWS.r, Constants::COLOR_WINDOWS.g, Constants::COLOR_WINDOWS.b),
-            vec3(Constants::COLOR_WINDOWS.r, Constants::COLOR_WINDOWS.g, Constants::COLOR_WINDOWS.b),
-            vec3(Constants::COLOR_WINDOWS.r, Constants::COLOR_WINDOWS.g, Constants::COLOR_WINDOWS.b),
-            vec3(Constants::COLOR_WINDOWS.r, Constants::COLOR_WINDOWS.g, Constants::COLOR_WINDOWS.b),
-            vec3(Constants::COLOR_WINDOWS.r, Constants::COLOR_WINDOWS.g, Constants::COLOR_WINDOWS.b),
-            vec3(Constants::COLOR_WINDOWS.r, Constants::COLOR_WINDOWS.g, Constants::COLOR_WINDOWS.b),
-            vec3(Constants::COLOR_FRAMES.r, Constants::COLOR_FRAMES.g, Constants::COLOR_FRAMES.b),
-            vec3(Constants::COLOR_FRAMES.r, Constants::COLOR_FRAMES.g, Constants::COLOR_FRAMES.b),
-            vec3(Constants::COLOR_FRAMES.r, Constants::COLOR_FRAMES.g, Constants::COLOR_FRAMES.b),
-            vec3(Constants::COLOR_FRAMES.r, Constants::COLOR_FRAMES.g, Constants::COLOR_FRAMES.b),
-            vec3(Constants::COLOR_FRAMES.r, Constants::COLOR_FRAMES.g, Constants::COLOR_FRAMES.b),
-            vec3(Constants::COLOR_FRAMES.r, Constants::COLOR_FRAMES.g, Constants::COLOR_FRAMES.b),
-            vec3(Constants::COLOR_FRAMES.r, Constants::COLOR_FRAMES.g, Constants::COLOR_FRAMES.b),
-            vec3(Constants::COLOR_FRAMES.r, Constants::COLOR_FRAMES.g, Constants::COLOR_FRAMES.b),
-            vec3(Constants::COLOR_FRAMES.r, Constants::COLOR_FRAMES.g, Constants::COLOR_FRAMES.b),
-            vec3(Constants::COLOR_FRAMES.r, Constants::COLOR_FRAMES.g, Constants::COLOR_FRAMES.b),
-            vec3(Constants::COLOR_FRAMES.r, Constants::COLOR_FRAMES.g, Constants::COLOR_FRAMES.b),
-            vec3(Constants::COLOR_FRAMES.r, Constants::COLOR_FRAMES.g, Constants::COLOR_FRAMES.b),
-            vec3(Constants::COLOR_FRAMES.r, Constants::COLOR_FRAMES.g, Constants::COLOR_FRAMES.b),
-            vec3(Constants::COLOR_FRAMES.r, Constants::COLOR_FRAMES.g, Constants::COLOR_FRAMES.b),
-            vec3(Constants::COLOR_FRAMES.r, Constants::COLOR_FRAMES.g, Constants::COLOR_FRAMES.b),
-            vec3(Constants::COLOR_FRAMES.r, Constants::COLOR_FRAMES.g, Constants::COLOR_FRAMES.b),
-            vec3(Constants::COLOR_FRAMES.r, Constants::COLOR_FRAMES.g, Constants::COLOR_FRAMES.b),
-            vec3(Constants::COLOR_FRAMES.r, Constants::COLOR_FRAMES.g, Constants::COLOR_FRAMES.b),
-            vec3(Constants::COLOR_FRAMES.r, Constants::COLOR_FRAMES.g, Constants::COLOR_FRAMES.b),
-            vec3(Constants::COLOR_FRAMES.r, Constants::COLOR_FRAMES.g, Constants::COLOR_FRAMES.b),
-            vec3(Constants::COLOR_FRAMES.r, Constants::COLOR_FRAMES.g, Constants::COLOR_FRAMES.b),
-            vec3(Constants::COLOR_FRAMES.r, Constants::COLOR_FRAMES.g, Constants::COLOR_FRAMES.b),
-            vec3(Constants::COLOR_FRAMES.r, Constants::COLOR_FRAMES.g, Constants::COLOR_FRAMES.b),
-            vec3(Constants::COLOR_FRAMES.r, Constants::COLOR_FRAMES.g, Constants::COLOR_FRAMES.b),
-            vec3(Constants::COLOR_FRAMES.r, Constants::COLOR_FRAMES.g, Constants::COLOR_FRAMES.b),
-            vec3(Constants::COLOR_FRAMES.r, Constants::COLOR_FRAMES.g, Constants::COLOR_FRAMES.b),
-            vec3(Constants::COLOR_FRAMES.r, Constants::COLOR_FRAMES.g, Constants::COLOR_FRAMES.b),
-            vec3(Constants::COLOR_FRAMES.r, Constants::COLOR_FRAMES.g, Constants::COLOR_FRAMES.b),
-            vec3(Constants::COLOR_FRAMES.r, Constants::COLOR_FRAMES.g, Constants::COLOR_FRAMES.b),
-            vec3(Constants::COLOR_FRAMES.r, Constants::COLOR_FRAMES.g, Constants::COLOR_FRAMES.b),
-            vec3(Constants::COLOR_FRAMES.r, Constants::COLOR_FRAMES.g, Constants::COLOR_FRAMES.b),
-            vec3(Constants::COLOR_FRAMES.r, Constants::COLOR_FRAMES.g, Constants::COLOR_FRAMES.b),
-            vec3(Constants::COLOR_FRAMES.r, Constants::COLOR_FRAMES.g, Constants::COLOR_FRAMES.b),
-            vec3(Constants::COLOR_FRAMES.r, Constants::COLOR_FRAMES.g, Constants::COLOR_FRAMES.b),
-            vec3(Constants::COLOR_FRAMES.r, Constants::COLOR_FRAMES.g, Constants::COLOR_FRAMES.b),
-            vec3(Constants::COLOR_FRAMES.r, Constants::COLOR_FRAMES.g, Constants::COLOR_FRAMES.b),
-            vec3(Constants::COLOR_FRAMES.r, Constants::COLOR_FRAMES.g, Constants::COLOR_FRAMES.b),
-            vec3(Constants::COLOR_FRAMES.r, Constants::COLOR_FRAMES.g, Constants::COLOR_FRAMES.b),
-            vec3(Constants::COLOR_FRAMES.r, Constants::COLOR_FRAMES.g, Constants::COLOR_FRAMES.b),
-            vec3(Constants::COLOR_FRAMES.r, Constants::COLOR_FRAMES.g, Constants::COLOR_FRAMES.b),
-            vec3(Constants::COLOR_FRAMES.r, Constants::COLOR_FRAMES.g, Constants::COLOR_FRAMES.b),
-            vec3(Constants::COLOR_FRAMES.r, Constants::COLOR_FRAMES.g, Constants::COLOR_FRAMES.b),
-            vec3(Constants::COLOR_FRAMES.r, Constants::COLOR_FRAMES.g, Constants::COLOR_FRAMES.b),
-            vec3(Constants::COLOR_FRAMES.r, Constants::COLOR_FRAMES.g, Constants::COLOR_FRAMES.b),
-            vec3(Constants::COLOR_FRAMES.r, Constants::COLOR_FRAMES.g, Constants::COLOR_FRAMES.b),
-            vec3(Constants::COLOR_FRAMES.r, Constants::COLOR_FRAMES.g, Constants::COLOR_FRAMES.b),
-            vec3(Constants::COLOR_FRAMES.r, Constants::COLOR_FRAMES.g, Constants::COLOR_FRAMES.b),
-            vec3(Constants::COLOR_FRAMES.r, Constants::COLOR_FRAMES.g, Constants::COLOR_FRAMES.b),
-            vec3(Constants::COLOR_FRAMES.r, Constants::COLOR_FRAMES.g, Constants::COLOR_FRAMES.b),
-            vec3(Constants::COLOR_FRAMES.r, Constants::COLOR_FRAMES.g, Constants::COLOR_FRAMES.b),
-            vec3(Constants::COLOR_FRAMES.r, Constants::COLOR_FRAMES.g, Constants::COLOR_FRAMES.b),
-            vec3(Constants::COLOR_FRAMES.r, Constants::COLOR_FRAMES.g, Constants::COLOR_FRAMES.b),
-            vec3(Constants::COLOR_FRAMES.r, Constants::COLOR_FRAMES.g, Constants::COLOR_FRAMES.b),
-            vec3(Constants::COLOR_FRAMES.r, Constants::COLOR_FRAMES.g, Constants::COLOR_FRAMES.b),
-            vec3(Constants::COLOR_FRAMES.r, Constants::COLOR_FRAMES.g, Constants::COLOR_FRAMES.b),
-            vec3(Constants::COLOR_FRAMES.r, Constants::COLOR_FRAMES.g, Constants::COLOR_FRAMES.b),
-            vec3(Constants::COLOR_FRAMES.r, Constants::COLOR_FRAMES.g, Constants::COLOR_FRAMES.b),
-            vec3(Constants::COLOR_FRAMES.r, Constants::COLOR_FRAMES.g, Constants::COLOR_FRAMES.b),
-            vec3(Constants::COLOR_FRAMES.r, Constants::COLOR_FRAMES.g, Constants::COLOR_FRAMES.b),
-            vec3(Constants::COLOR_FRAMES.r, Constants::COLOR_FRAMES.g, Constants::COLOR_FRAMES.b),
-            vec3(Constants::COLOR_FRAMES.r, Constants::COLOR_FRAMES.g, Constants::COLOR_FRAMES.b),
-            vec3(Constants::COLOR_FRAMES.r, Constants::COLOR_FRAMES.g, Constants::COLOR_FRAMES.b),
-            vec3(Constants::COLOR_FRAMES.r, Constants::COLOR_FRAMES.g, Constants::COLOR_FRAMES.b),
-            vec3(Constants::COLOR_FRAMES.r, Constants::COLOR_FRAMES.g, Constants::COLOR_FRAMES.b),
-            vec3(Constants::COLOR_FRAMES.r, Constants::COLOR_FRAMES.g, Constants::COLOR_FRAMES.b),
-            vec3(Constants::COLOR_FRAMES.r, Constants::COLOR_FRAMES.g, Constants::COLOR_FRAMES.b),
-            vec3(Constants::COLOR_FRAMES.r, Constants::COLOR_FRAMES.g, Constants::COLOR_FRAMES.b),
-            vec3(Constants::COLOR_FRAMES.r, Constants::COLOR_FRAMES.g, Constants::COLOR_FRAMES.b),
-            vec3(Constants::COLOR_FRAMES.r, Constants::COLOR_FRAMES.g, Constants::COLOR_FRAMES.b),
-            vec3(Constants::COLOR_FRAMES.r, Constants::COLOR_FRAMES.g, Constants::COLOR_FRAMES.b),
-            vec3(Constants::COLOR_FRAMES.r, Constants::COLOR_FRAMES.g, Constants::COLOR_FRAMES.b),
-            vec3(Constants::COLOR_FRAMES.r, Constants::COLOR_FRAMES.g, Constants::COLOR_FRAMES.b),
-            vec3(Constants::COLOR_FRAMES.r, Constants::COLOR_FRAMES.g, Constants::COLOR_FRAMES.b),
-            vec3(Constants::COLOR_FRAMES.r, Constants::COLOR_FRAMES.g, Constants::COLOR_FRAMES.b),
-            vec3(Constants::COLOR_FRAMES.r, Constants::COLOR_FRAMES.g, Constants::COLOR_FRAMES.b),
-            vec3(Constants::COLOR_FRAMES.r, Constants::COLOR_FRAMES.g, Constants::COLOR_FRAMES.b),
-            vec3(Constants::COLOR_FRAMES.r, Constants::COLOR_FRAMES.g, Constants::COLOR_FRAMES.b),
-            vec3(Constants::COLOR_FRAMES.r, Constants::COLOR_FRAMES.g, Constants::COLOR_FRAMES.b),
-            vec3(Constants::COLOR_FRAMES.r, Constants::COLOR_FRAMES.g, Constants::COLOR_FRAMES.b),
-            vec3(Constants::COLOR_FRAMES.r, Constants::COLOR_FRAMES.g, Constants::COLOR_FRAMES.b),
-            vec3(Constants::COLOR_FRAMES.r, Constants::COLOR_FRAMES.g, Constants::COLOR_FRAMES.b),
-            vec3(Constants::COLOR_FRAMES.r, Constants::COLOR_FRAMES.g, Constants::COLOR_FRAMES.b),
-            vec3(Constants::COLOR_FRAMES.r, Constants::COLOR_FRAMES.g, Constants::COLOR_FRAMES.b),
-            vec3(Constants::COLOR_FRAMES.r, Constants::COLOR_FRAMES.g, Constants::COLOR_FRAMES.b),
-            vec3(Constants::COLOR_FRAMES.r, Constants::COLOR_FRAMES.g, Constants::COLOR_FRAMES.b),
-            vec3(Constants::COLOR_FRAMES.r, Constants::COLOR_FRAMES.g, Constants::COLOR_FRAMES.b),
-            vec3(Constants::COLOR_FRAMES.r, Constants::COLOR_FRAMES.g, Constants::COLOR_FRAMES.b),
-            vec3(Constants::COLOR_FRAMES.r, Constants::COLOR_FRAMES.g, Constants::COLOR_FRAMES.b),
-            vec3(Constants::COLOR_FRAMES.r, Constants::COLOR_FRAMES.g, Constants::COLOR_FRAMES.b),
-            vec3(Constants::COLOR_FRAMES.r, Constants::COLOR_FRAMES.g, Constants::COLOR_FRAMES.b),
-            vec3(Constants::COLOR_FRAMES.r, Constants::COLOR_FRAMES.g, Constants::COLOR_FRAMES.b),
-            vec3(Constants::COLOR_FRAMES.r, Constants::COLOR_FRAMES.g, Constants::COLOR_FRAMES.b),
-            vec3(Constants::COLOR_FRAMES.r, Constants::COLOR_FRAMES.g, Constants::COLOR_FRAMES.b),
-            vec3(Constants::COLOR_FRAMES.r, Constants::COLOR_FRAMES.g, Constants::COLOR_FRAMES.b),
-            vec3(Constants::COLOR_FRAMES.r, Constants::COLOR_FRAMES.g, Constants::COLOR_FRAMES.b),
-            vec3(Constants::COLOR_FRAMES.r, Constants::COLOR_FRAMES.g, Constants::COLOR_FRAMES.b),
-            vec3(Constants::COLOR_FRAMES.r, Constants::COLOR_FRAMES.g, Constants::COLOR_FRAMES.b),
-            vec3(Constants::COLOR_FRAMES.r, Constants::COLOR_FRAMES.g, Constants::COLOR_FRAMES.b),
-            vec3(Constants::COLOR_FRAMES.r, Constants::COLOR_FRAMES.g, Constants::COLOR_FRAMES.b),
-            vec3(Constants::COLOR_FRAMES.r, Constants::COLOR_FRAMES.g, Constants::COLOR_FRAMES.b),
-            vec3(Constants::COLOR_ROOF.r, Constants::COLOR_ROOF.g, Constants::COLOR_ROOF.b),
-            vec3(Constants::COLOR_ROOF.r, Constants::COLOR_ROOF.g, Constants::COLOR_ROOF.b),
-            vec3(Constants::COLOR_ROOF.r, Constants::COLOR_ROOF.g, Constants::COLOR_ROOF.b),
-            vec3(Constants::COLOR_ROOF.r, Constants::COLOR_ROOF.g, Constants::COLOR_ROOF.b),
-            vec3(Constants::COLOR_ROOF.r, Constants::COLOR_ROOF.g, Constants::COLOR_ROOF.b),
-            vec3(Constants::COLOR_ROOF.r, Constants::COLOR_ROOF.g, Constants::COLOR_ROOF.b),
-            vec3(Constants::COLOR_ROOF.r, Constants::COLOR_ROOF.g, Constants::COLOR_ROOF.b),
-            vec3(Constants::COLOR_ROOF.r, Constants::COLOR_ROOF.g, Constants::COLOR_ROOF.b),
-            vec3(Constants::COLOR_ROOF.r, Constants::COLOR_ROOF.g, Constants::COLOR_ROOF.b),
-            vec3(Constants::COLOR_ROOF.r, Constants::COLOR_ROOF.g, Constants::COLOR_ROOF.b),
-            vec3(Constants::COLOR_ROOF.r, Constants::COLOR_ROOF.g, Constants::COLOR_ROOF.b),
-            vec3(Constants::COLOR_ROOF.r, Constants::COLOR_ROOF.g, Constants::COLOR_ROOF.b),
-            vec3(Constants::COLOR_ROOF.r, Constants::COLOR_ROOF.g, Constants::COLOR_ROOF.b),
-            vec3(Constants::COLOR_ROOF.r, Constants::COLOR_ROOF.g, Constants::COLOR_ROOF.b),
-            vec3(Constants::COLOR_ROOF.r, Constants::COLOR_ROOF.g, Constants::COLOR_ROOF.b),
-            vec3(Constants::COLOR_ROOF.r, Constants::COLOR_ROOF.g, Constants::COLOR_ROOF.b),
-            vec3(Constants::COLOR_ROOF.r, Constants::COLOR_ROOF.g, Constants::COLOR_ROOF.b),
-            vec3(Constants::COLOR_ROOF.r, Constants::COLOR_ROOF.g, Constants::COLOR_ROOF.b),
-            vec3(Constants::COLOR_ROOF.r, Constants::COLOR_ROOF.g, Constants::COLOR_ROOF.b),
-            vec3(Constants::COLOR_ROOF.r, Constants::COLOR_ROOF.g, Constants::COLOR_ROOF.b),
-            vec3(Constants::COLOR_ROOF.r, Constants::COLOR_ROOF.g, Constants::COLOR_ROOF.b),
-            vec3(Constants::COLOR_ROOF.r, Constants::COLOR_ROOF.g, Constants::COLOR_ROOF.b),
-            vec3(Constants::COLOR_ROOF.r, Constants::COLOR_ROOF.g, Constants::COLOR_ROOF.b),
-            vec3(Constants::COLOR_ROOF.r, Constants::COLOR_ROOF.g, Constants::COLOR_ROOF.b),
-            vec3(Constants::COLOR_ROOF.r, Constants::COLOR_ROOF.g, Constants::COLOR_ROOF.b),
-            vec3(Constants::COLOR_ROOF.r, Constants::COLOR_ROOF.g, Constants::COLOR_ROOF.b),
-            vec3(Constants::COLOR_ROOF.r, Constants::COLOR_ROOF.g, Constants::COLOR_ROOF.b),
-            vec3(Constants::COLOR_ROOF.r, Constants::COLOR_ROOF.g, Constants::COLOR_ROOF.b),
-            vec3(Constants::COLOR_ROOF.r, Constants::COLOR_ROOF.g, Constants::COLOR_ROOF.b),
-            vec3(Constants::COLOR_ROOF.r, Constants::COLOR_ROOF.g, Constants::COLOR_ROOF.b),
-            vec3(Constants::COLOR_ROOF.r, Constants::COLOR_ROOF.g, Constants::COLOR_ROOF.b),
-            vec3(Constants::COLOR_ROOF.r, Constants::COLOR_ROOF.g, Constants::COLOR_ROOF.b),
-            vec3(Constants::COLOR_ROOF.r, Constants::COLOR_ROOF.g, Constants::COLOR_ROOF.b),
-            vec3(Constants::COLOR_ROOF.r, Constants::COLOR_ROOF.g, Constants::COLOR_ROOF.b),
-            vec3(Constants::COLOR_ROOF.r, Constants::COLOR_ROOF.g, Constants::COLOR_ROOF.b),
-            vec3(Constants::COLOR_ROOF.r, Constants::COLOR_ROOF.g, Constants::COLOR_ROOF.b),
-            vec3(Constants::COLOR_ROOF.r, Constants::COLOR_ROOF.g, Constants::COLOR_ROOF.b),
-            vec3(Constants::COLOR_ROOF.r, Constants::COLOR_ROOF.g, Constants::COLOR_ROOF.b),
-            vec3(Constants::COLOR_ROOF.r, Constants::COLOR_ROOF.g, Constants::COLOR_ROOF.b),
-            vec3(Constants::COLOR_ROOF.r, Constants::COLOR_ROOF.g, Constants::COLOR_ROOF.b),
-            vec3(Constants::COLOR_ROOF.r, Constants::COLOR_ROOF.g, Constants::COLOR_ROOF.b),
-            vec3(Constants::COLOR_ROOF.r, Constants::COLOR_ROOF.g, Constants::COLOR_ROOF.b),
-            vec3(Constants::COLOR_ROOF.r, Constants::COLOR_ROOF.g, Constants::COLOR_ROOF.b),
-            vec3(Constants::COLOR_ROOF.r, Constants::COLOR_ROOF.g, Constants::COLOR_ROOF.b),
-            vec3(Constants::COLOR_ROOF.r, Constants::COLOR_ROOF.g, Constants::COLOR_ROOF.b),
-            vec3(Constants::COLOR_ROOF.r, Constants::COLOR_ROOF.g, Constants::COLOR_ROOF.b),
-            vec3(Constants::COLOR_ROOF.r, Constants::COLOR_ROOF.g, Constants::COLOR_ROOF.b),
-            vec3(Constants::COLOR_ROOF.r, Constants::COLOR_ROOF.g, Constants::COLOR_ROOF.b),
-            vec3(Constants::COLOR_CHIMNEY.r, Constants::COLOR_CHIMNEY.g, Constants::COLOR_CHIMNEY.b),
-            vec3(Constants::COLOR_CHIMNEY.r, Constants::COLOR_CHIMNEY.g, Constants::COLOR_CHIMNEY.b),
-            vec3(Constants::COLOR_CHIMNEY.r, Constants::COLOR_CHIMNEY.g, Constants::COLOR_CHIMNEY.b),
-            vec3(Constants::COLOR_CHIMNEY.r, Constants::COLOR_CHIMNEY.g, Constants::COLOR_CHIMNEY.b),
-            vec3(Constants::COLOR_CHIMNEY.r, Constants::COLOR_CHIMNEY.g, Constants::COLOR_CHIMNEY.b),
-            vec3(Constants::COLOR_CHIMNEY.r, Constants::COLOR_CHIMNEY.g, Constants::COLOR_CHIMNEY.b),
-            vec3(Constants::COLOR_CHIMNEY.r, Constants::COLOR_CHIMNEY.g, Constants::COLOR_CHIMNEY.b),
-            vec3(Constants::COLOR_CHIMNEY.r, Constants::COLOR_CHIMNEY.g, Constants::COLOR_CHIMNEY.b),
-            vec3(Constants::COLOR_CHIMNEY.r, Constants::COLOR_CHIMNEY.g, Constants::COLOR_CHIMNEY.b),
-            vec3(Constants::COLOR_CHIMNEY.r, Constants::COLOR_CHIMNEY.g, Constants::COLOR_CHIMNEY.b),
-            vec3(Constants::COLOR_CHIMNEY.r, Constants::COLOR_CHIMNEY.g, Constants::COLOR_CHIMNEY.b),
-            vec3(Constants::COLOR_CHIMNEY.r, Constants::COLOR_CHIMNEY.g, Constants::COLOR_CHIMNEY.b),
-            vec3(Constants::COLOR_CHIMNEY.r, Constants::COLOR_CHIMNEY.g, Constants::COLOR_CHIMNEY.b),
-            vec3(Constants::COLOR_CHIMNEY.r, Constants::COLOR_CHIMNEY.g, Constants::COLOR_CHIMNEY.b),
-            vec3(Constants::COLOR_CHIMNEY.r, Constants::COLOR_CHIMNEY.g, Constants::COLOR_CHIMNEY.b),
-            vec3(Constants::COLOR_CHIMNEY.r, Constants::COLOR_CHIMNEY.g, Constants::COLOR_CHIMNEY.b),
-            vec3(Constants::COLOR_CHIMNEY.r, Constants::COLOR_CHIMNEY.g, Constants::COLOR_CHIMNEY.b),
-            vec3(Constants::COLOR_CHIMNEY.r, Constants::COLOR_CHIMNEY.g, Constants::COLOR_CHIMNEY.b),
-            vec3(Constants::COLOR_CHIMNEY.r, Constants::COLOR_CHIMNEY.g, Constants::COLOR_CHIMNEY.b),
-            vec3(Constants::COLOR_CHIMNEY.r, Constants::COLOR_CHIMNEY.g, Constants::COLOR_CHIMNEY.b),
-            vec3(Constants::COLOR_CHIMNEY.r, Constants::COLOR_CHIMNEY.g, Constants::COLOR_CHIMNEY.b),
-            vec3(Constants::COLOR_CHIMNEY.r, Constants::COLOR_CHIMNEY.g, Constants::COLOR_CHIMNEY.b),
-            vec3(Constants::COLOR_CHIMNEY.r, Constants::COLOR_CHIMNEY.g, Constants::COLOR_CHIMNEY.b),
-            vec3(Constants::COLOR_CHIMNEY.r, Constants::COLOR_CHIMNEY.g, Constants::COLOR_CHIMNEY.b),
-            vec3(Constants::COLOR_ROAD.r, Constants::COLOR_ROAD.g, Constants::COLOR_ROAD.b),
-            vec3(Constants::COLOR_ROAD.r, Constants::COLOR_ROAD.g, Constants::COLOR_ROAD.b),
-            vec3(Constants::COLOR_ROAD.r, Constants::COLOR_ROAD.g, Constants::COLOR_ROAD.b),
-            vec3(Constants::COLOR_ROAD.r, Constants::COLOR_ROAD.g, Constants::COLOR_ROAD.b),
-    };
-    const vector<GLfloat> shininesses = {
-            // Grass
-            Constants::SHININESS_GRASS,
-            Constants::SHININESS_GRASS,
-            Constants::SHININESS_GRASS,
-            Constants::SHININESS_GRASS,
-            Constants::SHININESS_GRASS,
-            Constants::SHININESS_GRASS,
-            Constants::SHININESS_GRASS,
-            Constants::SHININESS_GRASS,
-            Constants::SHININESS_GRASS,
-            Constants::SHININESS_GRASS,
-            Constants::SHININESS_GRASS,
-            Constants::SHININESS_GRASS,
-            Constants::SHININESS_ROAD,
-            Constants::SHININESS_ROAD,
-            Constants::SHININESS_ROAD,
-            Constants::SHININESS_ROAD,
-            Constants::SHININESS_ROAD,
-            Constants::SHININESS_ROAD,
-            Constants::SHININESS_ROAD,
-            Constants::SHININESS_ROAD,
-            Constants::SHININESS_GRASS,
-            Constants::SHININESS_GRASS,
-            Constants::SHININESS_GRASS,
-            Constants::SHININESS_GRASS,
-            Constants::SHININESS_GRASS,
-            Constants::SHININESS_GRASS,
-            Constants::SHININESS_GRASS,
-            Constants::SHININESS_GRASS,
-            Constants::SHININESS_GRASS,
-            Constants::SHININESS_GRASS,
-            Constants::SHININESS_GRASS,
-            Constants::SHININESS_GRASS,
-            Constants::SHININESS_GRASS,
-            Constants::SHININESS_GRASS,
-            Constants::SHININESS_GRASS,
-            Constants::SHININESS_GRASS,
-            Constants::SHININESS_GRASS,
-            Constants::SHININESS_GRASS,
-            Constants::SHININESS_GRASS,
-            Constants::SHININESS_GRASS,
-            Constants::SHININESS_WALLS,
-            Constants::SHININESS_WALLS,
-            Constants::SHININESS_WALLS,
-            Constants::SHININESS_WALLS,
-            Constants::SHININESS_WALLS,
-            Constants::SHININESS_WALLS,
-            Constants::SHININESS_WALLS,
-            Constants::SHININESS_WALLS,
-            Constants::SHININESS_WALLS,
-            Constants::SHININESS_WALLS,
-            Constants::SHININESS_WALLS,
-            Constants::SHININESS_WALLS,
-            Constants::SHININESS_WALLS,
-            Constants::SHININESS_WALLS,
-            Constants::SHININESS_WALLS,
-            Constants::SHININESS_WALLS,
-            Constants::SHININESS_WALLS,
-            Constants::SHININESS_WALLS,
-            Constants::SHININESS_WALLS,
-            Constants::SHININESS_WALLS,
-            Constants::SHININESS_WALLS,
-            Constants::SHININESS_WALLS,
-            Constants::SHININESS_WALLS,
-            Constants::SHININESS_WALLS,
-            Constants::SHININESS_WALLS,
-            Constants::SHININESS_WALLS,
-            Constants::SHININESS_DOOR,
-            Constants::SHININESS_DOOR,
-            Constants::SHININESS_DOOR,
-            Constants::SHININESS_DOOR,
-            Constants::SHININESS_FRAMES,
-            Constants::SHININESS_FRAMES,
-            Constants::SHININESS_FRAMES,
-            Constants::SHININESS_FRAMES,
-            Constants::SHININESS_FRAMES,
-            Constants::SHININESS_FRAMES,
-            Constants::SHININESS_FRAMES,
-            Constants::SHININESS_FRAMES,
-            Constants::SHININESS_FRAMES,
-            Constants::SHININESS_FRAMES,
-            Constants::SHININESS_FRAMES,
-            Constants::SHININESS_FRAMES,
-            Constants::SHININESS_FRAMES,
-            Constants::SHININESS_FRAMES,
-            Constants::SHININESS_FRAMES,
-            Constants::SHININESS_FRAMES,
-            Constants::SHININESS_FRAMES,
-            Constants::SHININESS_FRAMES,
-            Constants::SHININESS_FRAMES,
-            Constants::SHININESS_FRAMES,
-            Constants::SHININESS_FRAMES,
-            Constants::SHININESS_FRAMES,
-            Constants::SHININESS_FRAMES,
-            Constants::SHININESS_FRAMES,
-            Constants::SHININESS_FRAMES,
-            Constants::SHININESS_FRAMES,
-            Constants::SHININESS_FRAMES,
-            Constants::SHININESS_FRAMES,
-            Constants::SHININESS_FRAMES,
-            Constants::SHININESS_FRAMES,
-            Constants::SHININESS_FRAMES,
-            Constants::SHININESS_FRAMES,
-            Constants::SHININESS_WINDOWS,
-            Constants::SHININESS_WINDOWS,
-            Constants::SHININESS_WINDOWS,
-            Constants::SHININESS_WINDOWS,
-            Constants::SHININESS_WINDOWS,
-            Constants::SHININESS_WINDOWS,
-            Constants::SHININESS_WINDOWS,
-            Constants::SHININESS_WINDOWS,
-            Constants::SHININESS_WINDOWS,
-            Constants::SHININESS_WINDOWS,
-            Constants::SHININESS_WINDOWS,
-            Constants::SHININESS_WINDOWS,
-            Constants::SHININESS_WINDOWS,
-            Constants::SHININESS_WINDOWS,
-            Constants::SHININESS_WINDOWS,
-            Constants::SHININESS_WINDOWS,
-            Constants::SHININESS_FRAMES,
-            Constants::SHININESS_FRAMES,
-            Constants::SHININESS_FRAMES,
-            Constants::SHININESS_FRAMES,
-            Constants::SHININESS_FRAMES,
-            Constants::SHININESS_FRAMES,
-            Constants::SHININESS_FRAMES,
-            Constants::SHININESS_FRAMES,
-            Constants::SHININESS_FRAMES,
-            Constants::SHININESS_FRAMES,
-            Constants::SHININESS_FRAMES,
-            Constants::SHININESS_FRAMES,
-            Constants::SHININESS_FRAMES,
-            Constants::SHININESS_FRAMES,
-            Constants::SHININESS_FRAMES,
-            Constants::SHININESS_FRAMES,
-            Constants::SHININESS_FRAMES,
-            Constants::SHININESS_FRAMES,
-            Constants::SHININESS_FRAMES,
-            Constants::SHININESS_FRAMES,
-            Constants::SHININESS_FRAMES,
-            Constants::SHININESS_FRAMES,
-            Constants::SHININESS_FRAMES,
-            Constants::SHININESS_FRAMES,
-            Constants::SHININESS_FRAMES,
-            Constants::SHININESS_FRAMES,
-            Constants::SHININESS_FRAMES,
-            Constants::SHININESS_FRAMES,
-            Constants::SHININESS_FRAMES,
-            Constants::SHININESS_FRAMES,
-            Constants::SHININESS_FRAMES,
-            Constants::SHININESS_FRAMES,
-            Constants::SHININESS_FRAMES,
-            Constants::SHININESS_FRAMES,
-            Constants::SHININESS_FRAMES,
-            Constants::SHININESS_FRAMES,
-            Constants::SHININESS_FRAMES,
-            Constants::SHININESS_FRAMES,
-            Constants::SHININESS_FRAMES,
-            Constants::SHININESS_FRAMES,
-            Constants::SHININESS_FRAMES,
-            Constants::SHININESS_FRAMES,
-            Constants::SHININESS_FRAMES,
-            Constants::SHININESS_FRAMES,
-            Constants::SHININESS_FRAMES,
-            Constants::SHININESS_FRAMES,
-            Constants::SHININESS_FRAMES,
-            Constants::SHININESS_FRAMES,
-            Constants::SHININESS_FRAMES,
-            Constants::SHININESS_FRAMES,
-            Constants::SHININESS_FRAMES,
-            Constants::SHININESS_FRAMES,
-            Constants::SHININESS_FRAMES,
-            Constants::SHININESS_FRAMES,
-            Constants::SHININESS_FRAMES,
-            Constants::SHININESS_FRAMES,
-            Constants::SHININESS_FRAMES,
-            Constants::SHININESS_FRAMES,
-            Constants::SHININESS_FRAMES,
-            Constants::SHININESS_FRAMES,
-            Constants::SHININESS_FRAMES,
-            Constants::SHININESS_FRAMES,
-            Constants::SHININESS_FRAMES,
-            Constants::SHININESS_FRAMES,
-            Constants::SHININESS_FRAMES,
-            Constants::SHININESS_FRAMES,
-            Constants::SHININESS_FRAMES,
-            Constants::SHININESS_FRAMES,
-            Constants::SHININESS_FRAMES,
-            Constants::SHININESS_FRAMES,
-            Constants::SHININESS_FRAMES,
-            Constants::SHININESS_FRAMES,
-            Constants::SHININESS_FRAMES,
-            Constants::SHININESS_FRAMES,
-            Constants::SHININESS_FRAMES,
-            Constants::SHININESS_FRAMES,
-            Constants::SHININESS_FRAMES,
-            Constants::SHININESS_FRAMES,
-            Constants::SHININESS_FRAMES,
-            Constants::SHININESS_FRAMES,
-            Constants::SHININESS_FRAMES,
-            Constants::SHININESS_FRAMES,
-            Constants::SHININESS_FRAMES,
-            Constants::SHININESS_FRAMES,
-            Constants::SHININESS_FRAMES,
-            Constants::SHININESS_FRAMES,
-            Constants::SHININESS_FRAMES,
-            Constants::SHININESS_FRAMES,
-            Constants::SHININESS_FRAMES,
-            Constants::SHININESS_FRAMES,
-            Constants::SHININESS_FRAMES,
-            Constants::SHININESS_FRAMES,
-            Constants::SHININESS_FRAMES,
-            Constants::SHININESS_FRAMES,
-            Constants::SHININESS_FRAMES,
-            Constants::SHININESS_FRAMES,
-            Constants::SHININESS_FRAMES,
-            Constants::SHININESS_FRAMES,
-            Constants::SHININESS_FRAMES,
-            Constants::SHININESS_FRAMES,
-            Constants::SHININESS_ROOF,
-            Constants::SHININESS_ROOF,
-            Constants::SHININESS_ROOF,
-            Constants::SHININESS_ROOF,
-            Constants::SHININESS_ROOF,
-            Constants::SHININESS_ROOF,
-            Constants::SHININESS_ROOF,
-            Constants::SHININESS_ROOF,
-            Constants::SHININESS_ROOF,
-            Constants::SHININESS_ROOF,
-            Constants::SHININESS_ROOF,
-            Constants::SHININESS_ROOF,
-            Constants::SHININESS_ROOF,
-            Constants::SHININESS_ROOF,
-            Constants::SHININESS_ROOF,
-            Constants::SHININESS_ROOF,
-            Constants::SHININESS_ROOF,
-            Constants::SHININESS_ROOF,
-            Constants::SHININESS_ROOF,
-            Constants::SHININESS_ROOF,
-            Constants::SHININESS_ROOF,
-            Constants::SHININESS_ROOF,
-            Constants::SHININESS_ROOF,
-            Constants::SHININESS_ROOF,
-            Constants::SHININESS_ROOF,
-            Constants::SHININESS_ROOF,
-            Constants::SHININESS_ROOF,
-            Constants::SHININESS_ROOF,
-            Constants::SHININESS_ROOF,
-            Constants::SHININESS_ROOF,
-            Constants::SHININESS_ROOF,
-            Constants::SHININESS_ROOF,
-            Constants::SHININESS_ROOF,
-            Constants::SHININESS_ROOF,
-            Constants::SHININESS_ROOF,
-            Constants::SHININESS_ROOF,
-            Constants::SHININESS_ROOF,
-            Constants::SHININESS_ROOF,
-            Constants::SHININESS_ROOF,
-            Constants::SHININESS_ROOF,
-            Constants::SHININESS_ROOF,
-            Constants::SHININESS_ROOF,
-            Constants::SHININESS_ROOF,
-            Constants::SHININESS_ROOF,
-            Constants::SHININESS_ROOF,
-            Constants::SHININESS_ROOF,
-            Constants::SHININESS_ROOF,
-            Constants::SHININESS_ROOF,
-            Constants::SHININESS_CHIMNEY,
-            Constants::SHININESS_CHIMNEY,
-            Constants::SHININESS_CHIMNEY,
-            Constants::SHININESS_CHIMNEY,
-            Constants::SHININESS_CHIMNEY,
-            Constants::SHININESS_CHIMNEY,
-            Constants::SHININESS_CHIMNEY,
-            Constants::SHININESS_CHIMNEY,
-            Constants::SHININESS_CHIMNEY,
-            Constants::SHININESS_CHIMNEY,
-            Constants::SHININESS_CHIMNEY,
-            Constants::SHININESS_CHIMNEY,
-            Constants::SHININESS_CHIMNEY,
-            Constants::SHININESS_CHIMNEY,
-            Constants::SHININESS_CHIMNEY,
-            Constants::SHININESS_CHIMNEY,
-            Constants::SHININESS_CHIMNEY,
-            Constants::SHININESS_CHIMNEY,
-            Constants::SHININESS_CHIMNEY,
-            Constants::SHININESS_CHIMNEY,
-            Constants::SHININESS_CHIMNEY,
-            Constants::SHININESS_CHIMNEY,
-            Constants::SHININESS_CHIMNEY,
-            Constants::SHININESS_CHIMNEY,
-            Constants::SHININESS_CHIMNEY,
-            Constants::SHININESS_CHIMNEY,
-            Constants::SHININESS_CHIMNEY,
-            Constants::SHININESS_CHIMNEY,
-    };
-    const vector<GLuint> indices = {
-            // Grass top
-            1, 0, 2, // 32, 43, 65
-            1, 2, 3, // 32, 65, 30
-            3, 2, 4, // 30, 65, 64
-            9, 3, 8, // 29, 30, 28
-            8, 3, 4, // 28, 30, 64
-            10, 8, 4, // 27, 28, 64
-            5, 11, 10, // 25, 35, 27
-            5, 10, 4,// 25, 27, 64
-            7, 5, 4, // 58, 25, 64
-            7, 6, 5, // 58, 34, 25
-            // Road top
-            18, 17, 16, // 34, 32, 30
-            18, 16, 12, // 34, 30, 25
-            19, 15, 14, // 35, 29, 28
-            19, 14, 13, // 35, 28, 27
-            // Grass front
-            23, 21, 20, // 50, 50, 43
-            23, 20, 22, // 59, 43, 58
-            // Grass right
-            27, 25, 24, // 66, 59, 58
-            27, 24, 26, // 66, 58, 64
-            // Grass back
-            31, 30, 28, // 67, 66, 64
-            31, 28, 29, // 67, 64, 65
-            // Grass left
-            33, 35, 34, // 50, 67, 65
-            33, 34, 32, // 50, 65, 43
-            // Grass bottom
-            38, 39, 36, // 66, 67, 50
-            38, 36, 37, // 66, 50, 59
-            // House front
-            44, 51, 43, // 58, 79, 56
-            43, 51, 46, // 56, 79, 61
-            42, 43, 46, // 54, 56, 81
-            42, 46, 41, // 54, 81, 51
-            41, 46, 40, // 61, 81, 50
-            52, 43, 42, // 55, 56, 54
-            47, 43, 52, // 62, 56, 55
-            47, 48, 43, // 62, 63, 56
-            47, 49, 48, // 62, 64, 63
-            47, 50, 49, // 62, 65, 64
-            47, 52, 45, // 62, 55, 59
-            47, 45, 40, // 62, 59, 50
-            45, 41, 40, // 59, 51, 50
-            // House right
-            54, 55, 56, // 29, 62, 65
-            54, 53, 55, // 29, 62, 27
-            // House back
-            61, 58, 57, // 76, 29, 27
-            61, 57, 60, // 76, 27, 74
-            60, 57, 59, // 74, 27, 30
-            // House left
-            64, 63, 62, // 79, 76, 74
-            64, 62, 65, // 79, 74, 81
-            // Door
-            67, 68, 66, // 5, 6, 4
-            67, 69, 68, // 5, 7, 6
-            // Door frame - front
-            74, 75, 73, // 46, 47, 39
-            73, 75, 72, // 39, 47, 38
-            71, 74, 73, // 29, 46, 39
-            71, 77, 74, // 29, 55, 46
-            71, 76, 77, // 29, 54, 55
-            71, 70, 76, // 29, 23, 54
-            // Door frame - top
-            79, 80, 81, // 29, 37, 39
-            78, 80, 79, // 28, 29, 37
-            // Door frame - left
-            85, 84, 83, // 39, 38, 37
-            83, 84, 82, // 37, 38, 36
-            89, 88, 87, // 55, 54, 53
-            87, 88, 86, // 53, 54, 52
-            // Door frame - right
-            90, 93, 91, // 21, 29, 23
-            92, 90, 93, // 28, 21, 29
-            96, 95, 97, // 46, 45, 47
-            94, 95, 96, // 44, 45, 46
-            // Door frame - top
-            101, 100, 99, // 55, 53, 46
-            100, 98, 99, // 53, 46, 44
-            // Window - bottom left
-            102, 105, 104, // 4, 7, 6
-            103, 105, 102, // 5, 7, 4
-            // Window - bottom right
-            106, 109, 108, // 4, 7, 6
-            107, 109, 106, // 5, 7, 4
-            // Window - top left
-            110, 113, 112, // 4, 7, 6
-            111, 113, 110, // 5, 7, 4
-            // Window - top right
-            114, 117, 116, // 4, 7, 6
-            115, 117, 114, // 5, 7, 4
-            // Window - inner frame - front
-            125, 127, 128, // 102, 111, 117
-            125, 128, 126, // 102, 117, 103
-            124, 129, 122, // 93, 119, 66
-            124, 122, 121, // 93, 66, 55
-            124, 121, 118, // 93, 55, 37
-            124, 118, 123, // 93, 37, 81
-            118, 121, 120, // 37, 55, 54
-            118, 120, 119, // 37, 54, 39
-            // Window - inner frame - bottom
-            138, 139, 140, // 92, 93, 101
-            141, 140, 139, // 93, 101, 103
-            142, 143, 144, // 116, 117, 118
-            145, 144, 143, // 117, 118, 119
-            136, 137, 130, // 82, 84, 21
-            131, 130, 137, // 84, 21, 39
-            133, 131, 137, // 84, 39, 54
-            135, 133, 137, // 84, 54, 67
-            133, 134, 132, // 52, 54, 65
-            135, 134, 133, // 54, 65, 67
-            // Window - inner frame - left
-            155, 160, 161,     // 71, 118, 119
-            161, 155, 154, // 71, 119, 68
-            154, 161, 152,  // 66, 119, 68
-            152, 153, 154, // 66, 67, 68
-            152, 151, 153, // 66, 65, 67
-            150, 151, 152, // 64, 65, 66
-            156, 157, 158, // 100, 101, 102
-            157, 159, 158, // 101, 103, 102
-            146, 147, 148, // 20, 21, 37
-            147, 149, 148, // 21, 39, 37
-            // Window - inner frame - right
-            175, 177, 174, // 111, 117, 109
-            174, 177, 176, // 109, 117, 116
-            165, 164, 163, // 55, 54, 53
-            163, 164, 162, // 53, 54, 52
-            171, 173, 170, // 87, 93, 86
-            170, 173, 172, // 86, 93, 92
-            171, 169, 173, // 87, 84, 93
-            173, 169, 167, // 93, 84, 81
-            167, 169, 168, // 81, 84, 82
-            167, 168, 166, // 81, 82, 80
-            // Window - outer frame - front
-            184, 178, 185, // 37, 9, 39
-            184, 181, 178, // 37, 14, 9
-            184, 180, 181, // 37, 12, 14
-            184, 183, 180, // 37, 31, 12
-            183, 182, 180, // 31, 22, 12
-            180, 182, 179, // 12, 22, 11
-            179, 182, 185, // 11, 22, 39
-            178, 179, 185, // 9, 11, 39
-            // Window - inner frame - top
-            191, 192, 190, // 13, 14, 12
-            189, 191, 190, // 11, 13, 12
-            188, 189, 190, // 10, 11, 12
-            188, 187, 189, // 10, 9, 11
-            188, 186, 187, // 10, 8, 9
-            186, 193, 187, // 8, 15, 9
-            // Window - inner frame - bottom - left
-            194, 195, 196, // 4, 5, 6
-            195, 197, 196, // 5, 7, 6
-            // Window - inner frame - bottom - right
-            198, 199, 200, // 4, 5, 6
-            199, 201, 200, // 5, 7, 6
-            // Window - outer frame - bottom & top
-            204, 202, 203, // 29, 22, 20
-            205, 204, 203, // 31, 29, 22
-            206, 209, 208, // 36, 39, 38
-            209, 206, 207, // 37, 36, 39
-            // Window - outer frame - left & right
-            212, 215, 214, // 36, 37, 29
-            215, 212, 213, // 37, 29, 31
-            211, 216, 217,  // 39, 38, 22
-            216, 211, 210, // 38, 22, 20
-            // Roof - left slope top
-            219, 221, 218, // 135, 164, 133
-            218, 221, 220, // 133, 164, 162
-            // Roof - right slope top
-            224, 222, 225, // 133, 59, 135
-            222, 223, 225, // 59, 61, 135
-            // Roof - left slope bottom
-            228, 233, 229, // 108, 145, 110
-            228, 232, 233, // 108, 143, 145
-            234, 233, 235, // 154, 145, 155
-            233, 235, 230, // 145, 155, 118
-            230, 231, 226, // 118, 120, 78
-            230, 226, 227, // 118, 78, 85
-            // Roof - right slope bottom
-            237, 244, 245, // 35, 108, 110
-            237, 245, 237, // 35, 110, 35
-            240, 241, 236, // 51, 53, 26
-            240, 238, 236, // 51, 36, 26
-            243, 242, 240, // 85, 78, 51
-            242, 240, 239, // 78, 51, 44
-            // Roof - front
-            249, 248, 250, // 135, 110, 154
-            249, 250, 251,  // 135, 154, 164
-            247, 246, 249, // 61, 26, 135
-            246, 248, 249, // 26, 110, 135
-            // Roof - back
-            255, 254, 252, // 133, 85, 53
-            255, 252, 253, // 133, 53, 59
-            257, 256, 254, // 162, 155, 85
-            257, 254, 255, // 162, 85, 133
-            // Roof - bottom
-            260, 259, 258, // 59, 53, 26
-            260, 258, 261, // 59, 26, 61
-            265, 262, 264, // 164, 154, 162
-            262, 263, 264, // 154, 155, 162
-            // Chimney - outer - front & back
-            270, 269, 266, // 48, 39, 22
-            270, 266, 273, // 48, 22, 55
-            272, 267, 268, // 53, 31, 37
-            272, 268, 271, // 53, 37, 50
-            // Chimney - outer - left & right
-            279, 276, 278, // 50, 37, 48
-            276, 277, 278, // 37, 39, 48
-            281, 274, 275, // 55, 22, 31
-            281, 275, 280, // 55, 31, 53
-            // Chimney - outer - top
-            283, 284, 282, // 49, 50, 48
-            283, 282, 288, // 49, 48, 54
-            288, 282, 286, // 54, 48, 52
-            282, 286, 289, // 48, 52, 55
-            286, 289, 287, // 52, 55, 53
-            286, 287, 285, // 52, 53, 51
-            285, 287, 284, // 51, 53, 50
-            285, 284, 283, // 51, 50, 49
-            // Chimney - inner - top
-            292, 290, 291, // 6, 4, 5
-            292, 291, 293, // 6, 5, 7
-    };
+void bindShaderPrograms() {
+    for (auto variant = 0; variant < shaderManager.getVariantCount(); variant++) {
+        bindShaderProgram(shaderManager.getProgram(variant));
+    }
+}
 
-    // Set the normals
-    vector<vec3> normals(vertices.size());
-    for (int i = 0; i < indices.size(); i += 3) {
-        auto A = vertices[indices[i]];
-        auto B = vertices[indices[i + 1]];
-        auto C = vertices[indices[i + 2]];
+void initializeShaders() {
+    programCache.initialize(programCacheDirectory, isProgramCacheEnabled);
+    if (!shaderManager.initialize(programCache, shaderDirectory + "/shader.vert", shaderDirectory + "/shader.frag",
+                                  isShaderHotReloadEnabled)) {
+        cout << "ERROR::SHADER::NO_VALID_PROGRAM" << endl;
+        exit(EXIT_FAILURE);
+    }
 
-        auto AB = B - A;
-        auto AC = C - A;
-        auto ABxAC = normalize(glm::cross(AB, AC));
+    // Frame constants & materials
+    frameConstants.initialize();
+    materialTable.initialize();
+    clusteredLights.initialize(threadPool);
+    // Also without shadows, the full shader (--no-permutations) reads the maps
+    if (!shadowCascades.initialize(programCache, shaderDirectory + "/shadow.vert", shaderDirectory + "/shadow.frag")) {
+        isShadowMappingEnabled = false;
+    }
+    bindShaderProgram(shaderManager.getProgram());
 
-        normals[indices[i]] = ABxAC;
-        normals[indices[i + 1]] = ABxAC;
-        normals[indices[i + 2]] = ABxAC;
+    if (isOcclusionCullingEnabled &&
+        !occlusionCuller.initialize(programCache, shaderDirectory + "/depth.vert", shaderDirectory + "/depth.frag")) {
+        isOcclusionCullingEnabled = false;
+    }
+}
+
+// Compiles the variant for a draw made of materials up to the given shininess, on first use
+ShaderManager::VariantIndex selectShaderVariant(float maxShininess, BakedLighting bakedLighting) {
+    ShaderManager::VariantIndex variant = 0;
+    if (isPermutationEnabled) {
+        ShaderPermutation permutation;
+        permutation.hasSpecular = maxShininess > MATTE_SHININESS;
+        permutation.hasFog = isFogEnabled;
+        permutation.lightingModel = lightingModel;
+        permutation.hasPointLights = pointLightCount > 0;
+        permutation.bakedLighting = bakedLighting;
+        permutation.hasShadows = isShadowMappingEnabled;
+        variant = shaderManager.getVariant(permutation);
     }
 
-    return Mesh(0, vertices, colors, shininesses, indices, normals);
+    if (find(sceneVariants.begin(), sceneVariants.end(), variant) == sceneVariants.end()) {
+        sceneVariants.push_back(variant);
+    }
+    return variant;
 }
 
-Mesh createSphereMesh(GLuint firstIndex, vec3 center, float radius, vec3 color, float shininess) {
-    const auto NUM_PARALLELS = 10;
-    const auto NUM_MERIDIANS = 20;
-
-    const auto U_MIN = -M_PI / 2;
-    const auto U_MAX = M_PI / 2;
-    const auto STEP_U = (U_MAX - U_MIN) / NUM_PARALLELS;
-
-    const auto V_MIN = 0;
-    const auto V_MAX = 2 * M_PI;
-    const auto STEP_V = (V_MAX - V_MIN) / NUM_MERIDIANS;
-
-    vector<vec3> vertices((NUM_PARALLELS + 1) * NUM_MERIDIANS);
-    vector<vec3> colors((NUM_PARALLELS + 1) * NUM_MERIDIANS);
-    vector<GLfloat> shininesses((NUM_PARALLELS + 1) * NUM_MERIDIANS);
-    vector<vec3> normals((NUM_PARALLELS + 1) * NUM_MERIDIANS);
-    vector<GLuint> indices(6 * (NUM_PARALLELS + 1) * NUM_MERIDIANS);
-
-    for (auto meridian = 0; meridian < NUM_MERIDIANS; meridian++) {
-        for (auto parallel = 0; parallel < NUM_PARALLELS + 1; parallel++) {
-            const auto u = U_MIN + parallel * STEP_U;
-            const auto v = V_MIN + meridian * STEP_V;
-            const auto x = center.x + radius * cosf(u) * cosf(v);
-            const auto y = center.y + radius * cosf(u) * sinf(v);
-            const auto z = center.z + radius * sinf(u);
-
-            const auto vertexIndex = meridian * (NUM_PARALLELS + 1) + parallel;
-            vertices[vertexIndex] = vec3(x, y, z);
-            colors[vertexIndex] = color;
-            shininesses[vertexIndex] = shininess;
-            normals[vertexIndex] = vec3(x - center.x, y - center.y, z - center.z);
-
-            if ((parallel + 1) % (NUM_PARALLELS + 1) != 0) {
-                const auto indexA = vertexIndex;
-                auto indexB = vertexIndex + (NUM_PARALLELS + 1);
-                auto indexC = indexB + 1;
-                const auto indexD = vertexIndex + 1;
-                if (meridian == NUM_MERIDIANS - 1) {
-                    indexB = indexB % (NUM_PARALLELS + 1);
-                    indexC = indexC % (NUM_PARALLELS + 1);
-                }
+float getMaxShininess(const MeshView &mesh, const DrawRange &range) {
+    auto maxShininess = 0.0f;
+    for (auto i = range.indexOffset; i < range.indexOffset + range.indexCount; i++) {
+        const auto &vertex = mesh.vertices[mesh.indices[i] + range.baseVertex];
+        maxShininess = std::max(maxShininess, materialTable.get(vertex.material).shininess);
+    }
+    return maxShininess;
+}
 
-                indices[6 * vertexIndex] = firstIndex + indexA;
-                indices[6 * vertexIndex + 1] = firstIndex + indexB;
-                indices[6 * vertexIndex + 2] = firstIndex + indexC;
+GLubyte getPrimaryMaterial(const MeshView &mesh, const DrawRange &range) {
+    size_t counts[MaterialTable::MAX_MATERIALS] = {};
+    for (auto i = range.indexOffset; i < range.indexOffset + range.indexCount; i++) {
+        counts[mesh.vertices[mesh.indices[i] + range.baseVertex].material]++;
+    }
+    return (GLubyte) (max_element(counts, counts + MaterialTable::MAX_MATERIALS) - counts);
+}
 
-                indices[6 * vertexIndex + 3] = firstIndex + indexA;
-                indices[6 * vertexIndex + 4] = firstIndex + indexC;
-                indices[6 * vertexIndex + 5] = firstIndex + indexD;
-            }
-        }
+void reportShaders() {
+    const auto &programStats = programCache.getStats();
+    cout << "Shaders: " << shaderManager.getVariantCount() << " variants, " << programStats.missCount
+         << " compiled in " << programStats.compileMilliseconds << " ms, " << programStats.hitCount
+         << " loaded from cache in " << programStats.hitMilliseconds << " ms" << endl;
+    for (const auto variant: sceneVariants) {
+        cout << "    " << shaderManager.getPermutation(variant).getName() << endl;
     }
+}
 
-    return Mesh(firstIndex, vertices, colors, shininesses, indices, normals);
+void reportWelding(const string &name, const WeldStats &stats) {
+    cout << "Vertex welding (" << name << "): " << stats.vertexCountBefore << " -> "
+         << stats.vertexCountAfter << " vertices" << endl;
 }
 
-Mesh createCylinderMesh(GLuint firstIndex, vec3 center, float radius, float height, vec3 color, float shininess) {
-    const auto NUM_PARALLELS = 7;
-    const auto NUM_MERIDIANS = 25;
-
-    const auto U_MIN = -M_PI / 2;
-    const auto U_MAX = M_PI / 2;
-    const auto STEP_U = (U_MAX - U_MIN) / NUM_PARALLELS;
-
-    const auto V_MIN = 0;
-    const auto V_MAX = 2 * M_PI;
-    const auto STEP_V = (V_MAX - V_MIN) / NUM_MERIDIANS;
-
-    vector<vec3> vertices((NUM_PARALLELS + 1) * NUM_MERIDIANS + 2);
-    vector<vec3> colors((NUM_PARALLELS + 1) * NUM_MERIDIANS + 2);
-    vector<GLfloat> shininesses((NUM_PARALLELS + 1) * NUM_MERIDIANS + 2);
-    vector<vec3> normals((NUM_PARALLELS + 1) * NUM_MERIDIANS + 2);
-    vector<GLuint> indices(6 * (NUM_PARALLELS + 1) * NUM_MERIDIANS + 2 * 3 * NUM_MERIDIANS);
-
-    for (auto meridian = 0; meridian < NUM_MERIDIANS; meridian++) {
-        for (auto parallel = 0; parallel < NUM_PARALLELS + 1; parallel++) {
-            const auto u = U_MIN + parallel * STEP_U;
-            const auto v = V_MIN + meridian * STEP_V;
-            const auto x = center.x + radius * cosf(v);
-            const auto y = center.y + height * u / (U_MAX - U_MIN);
-            const auto z = center.z + radius * sinf(v);
-
-            const auto vertexIndex = meridian * (NUM_PARALLELS + 1) + parallel;
-            vertices[vertexIndex] = vec3(x, y, z);
-            colors[vertexIndex] = color;
-            shininesses[vertexIndex] = shininess;
-            normals[vertexIndex] = vec3(x - center.x, y - center.y, z - center.z);
-
-            if ((parallel + 1) % (NUM_PARALLELS + 1) != 0) {
-                const auto indexA = vertexIndex;
-                auto indexB = vertexIndex + (NUM_PARALLELS + 1);
-                auto indexC = indexB + 1;
-                const auto indexD = vertexIndex + 1;
-
-                if (meridian == NUM_MERIDIANS - 1) {
-                    indexB = indexB % (NUM_PARALLELS + 1);
-                    indexC = indexC % (NUM_PARALLELS + 1);
-                }
+// Platform & house - the platform (grass & road) comes first, followed by the house, both using the same vertices.
+// The tables are hashed into the scene cache key as they are, so editing them never leaves a stale cache behind.
+const vec3 PLATFORM_HOUSE_VERTICES[] = {
+    // Grass top
+    /* 0 (Grass top - 43) */vec3(-1029.73f, 0.0f, -920.41f),
+    /* 1 (Grass top - 32) */vec3(-96.5f, 0.0f, -920.41f),
+    /* 2 (Grass top - 65) */vec3(-1029.73f, 0.0f, 918.24f),
+    /* 3 (Grass top - 30) */vec3(-96.5f, 0.0f, -64.89f),
+    /* 4 (Grass top - 64) */vec3(880.5f, 0.0f, 918.24f),
+    /* 5 (Grass top - 25) */vec3(366.22f, 0.0f, -64.89f),
+    /* 6 (Grass top - 34) */vec3(366.22f, 0.0f, -920.41f),
+    /* 7 (Grass top - 58) */vec3(880.5f, 0.0f, -920.41f),
+    /* 8 (Grass top - 28) */vec3(47.62f, 0.0f, -40.76f),
+    /* 9 (Grass top - 29) */vec3(47.62f, 0.0f, -64.89f),
+    /* 10 (Grass top - 27) */vec3(233.2f, 0.0f, -40.76f),
+    /* 11 (Grass top - 35) */vec3(233.2f, 0.0f, -64.89f),
+    // Road top
+    /* 12 (Road top - 25) */vec3(366.22f, 0.0f, -64.89f),
+    /* 13 (Road top - 27) */vec3(233.2f, 0.0f, -40.76f),
+    /* 14 (Road top - 28) */vec3(47.62f, 0.0f, -40.76f),
+    /* 15 (Road top - 29) */vec3(47.62f, 0.0f, -64.89f),
+    /* 16 (Road top - 30) */vec3(-96.5f, 0.0f, -64.89f),
+    /* 17 (Road top - 32) */vec3(-96.5f, 0.0f, -920.41f),
+    /* 18 (Road top - 34) */vec3(366.22f, 0.0f, -920.41f),
+    /* 19 (Road top - 35) */vec3(233.2f, 0.0f, -64.89f),
+    // Grass front
+    /* 20 (Grass front - 43) */vec3(-1029.73f, 0.0f, -920.41f),
+    /* 21 (Grass front - 50) */vec3(-1029.73f, -48.1f, -920.41f),
+    /* 22 (Grass front - 58) */vec3(880.5f, 0.0f, -920.41f),
+    /* 23 (Grass front - 59) */vec3(880.5f, -48.1f, -920.41f),
+    // Grass right
+    /* 24 (Grass right - 58) */vec3(880.5f, 0.0f, -920.41f),
+    /* 25 (Grass right - 59) */vec3(880.5f, -48.1f, -920.41f),
+    /* 26 (Grass right - 64) */vec3(880.5f, 0.0f, 918.24f),
+    /* 27 (Grass right - 66) */vec3(880.5f, -48.1f, 918.24f),
+    // Grass back
+    /* 28 (Grass back - 64) */vec3(880.5f, 0.0f, 918.24f),
+    /* 29 (Grass back - 65) */vec3(-1029.73f, 0.0f, 918.24f),
+    /* 30 (Grass back - 66) */vec3(880.5f, -48.1f, 918.24f),
+    /* 31 (Grass back - 67) */vec3(-1029.73f, -48.1f, 918.24f),
+    // Grass left
+    /* 32 (Grass left - 43) */vec3(-1029.73f, 0.0f, -920.41f),
+    /* 33 (Grass left - 50) */vec3(-1029.73f, -48.1f, -920.41f),
+    /* 34 (Grass left - 65) */vec3(-1029.73f, 0.0f, 918.24f),
+    /* 35 (Grass left - 67) */vec3(-1029.73f, -48.1f, 918.24f),
+    // Grass bottom
+    /* 36 (Grass bottom - 50) */vec3(-1029.73f, -48.1f, -920.41f),
+    /* 37 (Grass bottom - 59) */vec3(880.5f, -48.1f, -920.41f),
+    /* 38 (Grass bottom - 66) */vec3(880.5f, -48.1f, 918.24f),
+    /* 39 (Grass bottom - 67) */vec3(-1029.73f, -48.1f, 918.24f),
+    // House front
+    /* 40 (House front - 50) */vec3(149.63f, 848.02f, -64.89f),
+    /* 41 (House front - 51) */vec3(62.39f, 678.83f, -64.89f),
+    /* 42 (House front - 54) */vec3(62.39f, 453.65f, -64.89f),
+    /* 43 (House front - 56) */vec3(31.46f, 316.43f, -64.89f),
+    /* 44 (House front - 58) */vec3(31.46f, 0.0f, -64.89f),
+    /* 45 (House front - 59) */vec3(223.28f, 678.83f, -64.89f),
+    /* 46 (House front - 81) */vec3(-224.47f, 466.78f, -64.89f),
+    /* 47 (House front - 62) */vec3(483.08f, 464.99f, -64.89f),
+    /* 48 (House front - 63) */vec3(249.36f, 316.43f, -64.89f),
+    /* 49 (House front - 64) */vec3(249.36f, 0.0f, -64.89f),
+    /* 50 (House front - 65) */vec3(483.08f, 0.0f, -64.89f),
+    /* 51 (House front - 79) */vec3(-224.47f, 0.0f, -64.89f),
+    /* 52 (House front - 55) */vec3(223.28f, 453.65f, -64.89f),
+    // House right
+    /* 53 (House right - 27) */vec3(483.08f, 464.99f, 636.31f),
+    /* 54 (House right - 29) */vec3(483.08f, 0.0f, 636.31f),
+    /* 55 (House right - 62) */vec3(483.08f, 464.99f, -64.89f),
+    /* 56 (House right - 65) */vec3(483.08f, 0.0f, -64.89f),
+    // House back
+    /* 57 (House back - 27) */vec3(483.08f, 464.99f, 636.31f),
+    /* 58 (House back - 29) */vec3(483.08f, 0.0f, 636.31f),
+    /* 59 (House back - 30) */vec3(149.63f, 848.02f, 636.31f),
+    /* 60 (House back - 74) */vec3(-224.47f, 466.78f, 636.31f),
+    /* 61 (House back - 76) */vec3(-224.47f, 0.0f, 636.31f),
+    // House left
+    /* 62 (House left - 74) */vec3(-224.47f, 466.78f, 636.31f),
+    /* 63 (House left - 76) */vec3(-224.47f, 0.0f, 636.31f),
+    /* 64 (House left - 79) */vec3(-224.47f, 0.0f, -64.89f),
+    /* 65 (House left - 81) */vec3(-224.47f, 466.78f, -64.89f),
+    // Door
+    /* 66 (Door - 4) */vec3(47.62f, 300.27f, -40.76f),
+    /* 67 (Door - 5) */vec3(233.2f, 300.27f, -40.76f),
+    /* 68 (Door - 6) */vec3(47.62f, 0.0f, -40.76f),
+    /* 69 (Door - 7) */vec3(233.2f, 0.0f, -40.76f),
+    // Door frame - front
+    /* 70 (Door frame - front - 23) */vec3(249.36f, 0.0f, -77.59f),
+    /* 71 (Door frame - front - 29) */vec3(249.36f, 316.43f, -77.59f),
+    /* 72 (Door frame - front - 38) */vec3(31.46f, 0.0f, -77.59f),
+    /* 73 (Door frame - front - 39) */vec3(31.46f, 316.43f, -77.59f),
+    /* 74 (Door frame - front - 46) */vec3(47.62f, 300.27f, -77.59f),
+    /* 75 (Door frame - front - 47) */vec3(47.62f, 0.0f, -77.59f),
+    /* 76 (Door frame - front - 54) */vec3(233.2f, 0.0f, -77.59f),
+    /* 77 (Door frame - front - 55) */vec3(233.2f, 300.27f, -77.59f),
+    // Door frame - top
+    /* 78 (Door frame - top - 28) */vec3(249.36f, 316.43f, -64.89f),
+    /* 79 (Door frame - top - 29) */vec3(249.36f, 316.43f, -77.59f),
+    /* 80 (Door frame - top - 37) */vec3(31.46f, 316.43f, -64.89f),
+    /* 81 (Door frame - top - 39) */vec3(31.46f, 316.43f, -77.59f),
+    // Door frame - left
+    /* 82 (Door frame - left - 36) */vec3(31.46f, 0.0f, -64.89f),
+    /* 83 (Door frame - left - 37) */vec3(31.46f, 316.43f, -64.89f),
+    /* 84 (Door frame - left - 38) */vec3(31.46f, 0.0f, -77.59f),
+    /* 85 (Door frame - left - 39) */vec3(31.46f, 316.43f, -77.59f),
+    /* 86 (Door frame - left - 52) */vec3(233.2f, 0.0f, -40.76f),
+    /* 87 (Door frame - left - 53) */vec3(233.2f, 300.27f, -40.76f),
+    /* 88 (Door frame - left - 54) */vec3(233.2f, 0.0f, -77.59f),
+    /* 89 (Door frame - left - 55) */vec3(233.2f, 300.27f, -77.59f),
+    // Door frame - right
+    /* 90 (Door frame - right - 21) */vec3(249.36f, 0.0f, -64.89f),
+    /* 91 (Door frame - right - 23) */vec3(249.36f, 0.0f, -77.59f),
+    /* 92 (Door frame - right - 28) */vec3(249.36f, 316.43f, -64.89f),
+    /* 93 (Door frame - right - 29) */vec3(249.36f, 316.43f, -77.59f),
+    /* 94 (Door frame - right - 44) */vec3(47.62f, 300.27f, -40.76f),
+    /* 95 (Door frame - right - 45) */vec3(47.62f, 0.0f, -40.76f),
+    /* 96 (Door frame - right - 46) */vec3(47.62f, 300.27f, -77.59f),
+    /* 97 (Door frame - right - 47) */vec3(47.62f, 0.0f, -77.59f),
+    // Door frame - top
+    /* 98 (Door frame - top - 44) */vec3(47.62f, 300.27f, -40.76f),
+    /* 99 (Door frame - top - 46) */vec3(47.62f, 300.27f, -77.59f),
+    /* 100 (Door frame - top - 53) */vec3(233.2f, 300.27f, -40.76f),
+    /* 101 (Door frame - top - 55) */vec3(233.2f, 300.27f, -77.59f),
+    // Window - bottom left
+    /* 102 (Window - bottom left - 4) */vec3(75.52f, 559.77f, -40.76f),
+    /* 103 (Window - bottom left - 5) */vec3(135.49f, 559.77f, -40.76f),
+    /* 104 (Window - bottom left - 6) */vec3(75.52f, 466.78f, -40.76f),
+    /* 105 (Window - bottom left - 7) */vec3(135.49f, 466.78f, -40.76f),
+    // Window - bottom right
+    /* 106 (Window - bottom right - 4) */vec3(150.1f, 559.77f, -40.76f),
+    /* 107 (Window - bottom right - 5) */vec3(210.14f, 559.77f, -40.76f),
+    /* 108 (Window - bottom right - 6) */vec3(150.1f, 466.78f, -40.76f),
+    /* 109 (Window - bottom right - 7) */vec3(210.14f, 466.78f, -40.76f),
+    // Window - top left
+    /* 110 (Window - top left - 4) */vec3(75.52f, 665.7f, -40.76f),
+    /* 111 (Window - top left - 5) */vec3(135.49f, 665.7f, -40.76f),
+    /* 112 (Window - top left - 6) */vec3(75.52f, 572.41f, -40.76f),
+    /* 113 (Window - top left - 7) */vec3(135.49f, 572.41f, -40.76f),
+    // Window - top right
+    /* 114 (Window - top right - 4) */vec3(150.1f, 665.7f, -40.76f),
+    /* 115 (Window - top right - 5) */vec3(210.14f, 665.7f, -40.76f),
+    /* 116 (Window - top right - 6) */vec3(150.1f, 572.41f, -40.76f),
+    /* 117 (Window - top right - 7) */vec3(210.14f, 572.41f, -40.76f),
+    // Window - inner frame - front
+    /* 118 (Window - inner frame - front - 37) */vec3(150.1f, 559.77f, -59.17f),
+    /* 119 (Window - inner frame - front - 39) */vec3(150.1f, 466.78f, -59.17f),
+    /* 120 (Window - inner frame - front - 54) */vec3(135.49f, 466.78f, -59.17f),
+    /* 121 (Window - inner frame - front - 55) */vec3(135.49f, 559.77f, -59.17f),
+    /* 122 (Window - inner frame - front - 66) */vec3(75.52f, 559.77f, -59.17f),
+    /* 123 (Window - inner frame - front - 81) */vec3(210.14f, 559.77f, -59.17f),
+    /* 124 (Window - inner frame - front - 93) */vec3(210.14f, 572.41f, -59.17f),
+    /* 125 (Window - inner frame - front - 102) */vec3(150.1f, 665.7f, -59.17f),
+    /* 126 (Window - inner frame - front - 103) */vec3(150.1f, 572.41f, -59.17f),
+    /* 127 (Window - inner frame - front - 111) */vec3(135.49f, 665.7f, -59.17f),
+    /* 128 (Window - inner frame - front - 117) */vec3(135.49f, 572.41f, -59.17f),
+    /* 129 (Window - inner frame - front - 119) */vec3(75.52f, 572.41f, -59.17f),
+    // Window - inner frame - bottom
+    /* 130 (Window - inner frame - bottom - 21) */vec3(150.1f, 466.78f, -40.76f),
+    /* 131 (Window - inner frame - bottom - 39) */vec3(150.1f, 466.78f, -59.17f),
+    /* 132 (Window - inner frame - bottom - 52) */vec3(135.49f, 466.78f, -40.76f),
+    /* 133 (Window - inner frame - bottom - 54) */vec3(135.49f, 466.78f, -59.17f),
+    /* 134 (Window - inner frame - bottom - 65) */vec3(75.52f, 466.78f, -40.76f),
+    /* 135 (Window - inner frame - bottom - 67) */vec3(75.52f, 466.78f, -77.59f),
+    /* 136 (Window - inner frame - bottom - 82) */vec3(210.14f, 466.78f, -40.76f),
+    /* 137 (Window - inner frame - bottom - 84) */vec3(210.14f, 466.78f, -77.59f),
+    /* 138 (Window - inner frame - bottom - 92) */vec3(210.14f, 572.41f, -40.76f),
+    /* 139 (Window - inner frame - bottom - 93) */vec3(210.14f, 572.41f, -59.17f),
+    /* 140 (Window - inner frame - bottom - 101) */vec3(150.1f, 572.41f, -40.76f),
+    /* 141 (Window - inner frame - bottom - 103) */vec3(150.1f, 572.41f, -59.17f),
+    /* 142 (Window - inner frame - bottom - 116) */vec3(135.49f, 572.41f, -40.76f),
+    /* 143 (Window - inner frame - bottom - 117) */vec3(135.49f, 572.41f, -59.17f),
+    /* 144 (Window - inner frame - bottom - 118) */vec3(75.52f, 572.41f, -40.76f),
+    /* 145 (Window - inner frame - bottom - 119) */vec3(75.52f, 572.41f, -59.17f),
+    // Window - inner frame - left
+    /* 146 (Window - inner frame - left - 20) */vec3(150.1f, 559.77f, -40.76f),
+    /* 147 (Window - inner frame - left - 21) */vec3(150.1f, 466.78f, -40.76f),
+    /* 148 (Window - inner frame - left - 37) */vec3(150.1f, 559.77f, -59.17f),
+    /* 149 (Window - inner frame - left - 39) */vec3(150.1f, 466.78f, -59.17f),
+    /* 150 (Window - inner frame - left - 64) */vec3(75.52f, 559.77f, -40.76f),
+    /* 151 (Window - inner frame - left - 65) */vec3(75.52f, 466.78f, -40.76f),
+    /* 152 (Window - inner frame - left - 66) */vec3(75.52f, 559.77f, -59.17f),
+    /* 153 (Window - inner frame - left - 67) */vec3(75.52f, 466.78f, -77.59f),
+    /* 154 (Window - inner frame - left - 68) */vec3(75.52f, 665.7f, -77.59f),
+    /* 155 (Window - inner frame - left - 71) */vec3(75.52f, 665.7f, -40.76f),
+    /* 156 (Window - inner frame - left - 100) */vec3(150.1f, 665.7f, -40.76f),
+    /* 157 (Window - inner frame - left - 101) */vec3(150.1f, 572.41f, -40.76f),
+    /* 158 (Window - inner frame - left - 102) */vec3(150.1f, 665.7f, -59.17f),
+    /* 159 (Window - inner frame - left - 103) */vec3(150.1f, 572.41f, -59.17f),
+    /* 160 (Window - inner frame - left - 118) */vec3(75.52f, 572.41f, -40.76f),
+    /* 161 (Window - inner frame - left - 119) */vec3(75.52f, 572.41f, -59.17f),
+    // Window - inner frame - right
+    /* 162 (Window - inner frame - right - 52) */vec3(135.49f, 466.78f, -40.76f),
+    /* 163 (Window - inner frame - right - 53) */vec3(135.49f, 559.77f, -40.76f),
+    /* 164 (Window - inner frame - right - 54) */vec3(135.49f, 466.78f, -59.17f),
+    /* 165 (Window - inner frame - right - 55) */vec3(135.49f, 559.77f, -59.17f),
+    /* 166 (Window - inner frame - right - 80) */vec3(210.14f, 559.77f, -40.76f),
+    /* 167 (Window - inner frame - right - 81) */vec3(210.14f, 559.77f, -59.17f),
+    /* 168 (Window - inner frame - right - 82) */vec3(210.14f, 466.78f, -40.76f),
+    /* 169 (Window - inner frame - right - 84) */vec3(210.14f, 466.78f, -77.59f),
+    /* 170 (Window - inner frame - right - 86) */vec3(210.14f, 665.7f, -40.76f),
+    /* 171 (Window - inner frame - right - 87) */vec3(210.14f, 665.7f, -77.59f),
+    /* 172 (Window - inner frame - right - 92) */vec3(210.14f, 572.41f, -40.76f),
+    /* 173 (Window - inner frame - right - 93) */vec3(210.14f, 572.41f, -59.17f),
+    /* 174 (Window - inner frame - right - 109) */vec3(135.49f, 665.7f, -40.76f),
+    /* 175 (Window - inner frame - right - 111) */vec3(135.49f, 665.7f, -59.17f),
+    /* 176 (Window - inner frame - right - 116) */vec3(135.49f, 572.41f, -40.76f),
+    /* 177 (Window - inner frame - right - 117) */vec3(135.49f, 572.41f, -59.17f),
+    // Window - outer frame - front
+    /* 178 (Window - outer frame - front - 9) */vec3(75.52f, 665.7f, -77.59f),
+    /* 179 (Window - outer frame - front - 11) */vec3(75.52f, 466.78f, -77.59f),
+    /* 180 (Window - outer frame - front - 12) */vec3(210.14f, 466.78f, -77.59f),
+    /* 181 (Window - outer frame - front - 14) */vec3(210.14f, 665.7f, -77.59f),
+    /* 182 (Window - outer frame - front - 22) */vec3(62.39f, 453.65f, -77.59f),
+    /* 183 (Window - outer frame - front - 31) */vec3(223.28f, 453.65f, -77.59f),
+    /* 184 (Window - outer frame - front - 37) */vec3(223.28f, 678.83f, -77.59f),
+    /* 185 (Window - outer frame - front - 39) */vec3(62.39f, 678.83f, -77.59f),
+    // Window - inner frame - top
+    /* 186 (Window - inner frame - top - 8) */vec3(210.14f, 665.7f, -40.76f),
+    /* 187 (Window - inner frame - top - 9) */vec3(150.1f, 665.7f, -59.17f),
+    /* 188 (Window - inner frame - top - 10) */vec3(210.14f, 665.7f, -77.59f),
+    /* 189 (Window - inner frame - top - 11) */vec3(135.49f, 665.7f, -59.17f),
+    /* 190 (Window - inner frame - top - 12) */vec3(75.52f, 665.7f, -77.59f),
+    /* 191 (Window - inner frame - top - 13) */vec3(135.49f, 665.7f, -40.76f),
+    /* 192 (Window - inner frame - top - 14) */vec3(75.52f, 665.7f, -40.76f),
+    /* 193 (Window - inner frame - top - 15) */vec3(150.1f, 665.7f, -40.76f),
+    // Window - inner frame - bottom - left
+    /* 194 (Window - inner frame - bottom - left - 4) */vec3(135.49f, 559.77f, -59.17f),
+    /* 195 (Window - inner frame - bottom - left - 5) */vec3(135.49f, 559.77f, -40.76f),
+    /* 196 (Window - inner frame - bottom - left - 6) */vec3(75.52f, 559.77f, -59.17f),
+    /* 197 (Window - inner frame - bottom - left - 7) */vec3(75.52f, 559.77f, -40.76f),
+    // Window - inner frame - bottom - right
+    /* 198 (Window - inner frame - bottom - right - 4) */vec3(210.14f, 559.77f, -59.17f),
+    /* 199 (Window - inner frame - bottom - right - 5) */vec3(210.14f, 559.77f, -40.76f),
+    /* 200 (Window - inner frame - bottom - right - 6) */vec3(150.1f, 559.77f, -59.17f),
+    /* 201 (Window - inner frame - bottom - right - 7) */vec3(150.1f, 559.77f, -40.76f),
+    // Window - outer frame - bottom & top
+    /* 202 (Window - outer frame - bottom & top - 20) */vec3(62.39f, 453.65f, -64.89f),
+    /* 203 (Window - outer frame - bottom & top - 22) */vec3(62.39f, 453.65f, -77.59f),
+    /* 204 (Window - outer frame - bottom & top - 29) */vec3(223.28f, 453.65f, -64.89f),
+    /* 205 (Window - outer frame - bottom & top - 31) */vec3(223.28f, 453.65f, -77.59f),
+    /* 206 (Window - outer frame - bottom & top - 36) */vec3(223.28f, 678.83f, -64.89f),
+    /* 207 (Window - outer frame - bottom & top - 37) */vec3(223.28f, 678.83f, -77.59f),
+    /* 208 (Window - outer frame - bottom & top - 38) */vec3(62.39f, 678.83f, -64.89f),
+    /* 209 (Window - outer frame - bottom & top - 39) */vec3(62.39f, 678.83f, -77.59f),
+    // Window - outer frame - left & right
+    /* 210 (Window - outer frame - left & right - 20) */vec3(62.39f, 453.65f, -64.89f),
+    /* 211 (Window - outer frame - left & right - 22) */vec3(62.39f, 453.65f, -77.59f),
+    /* 212 (Window - outer frame - left & right - 29) */vec3(223.28f, 453.65f, -64.89f),
+    /* 213 (Window - outer frame - left & right - 31) */vec3(223.28f, 453.65f, -77.59f),
+    /* 214 (Window - outer frame - left & right - 36) */vec3(223.28f, 678.83f, -64.89f),
+    /* 215 (Window - outer frame - left & right - 37) */vec3(223.28f, 678.83f, -77.59f),
+    /* 216 (Window - outer frame - left & right - 38) */vec3(62.39f, 678.83f, -64.89f),
+    /* 217 (Window - outer frame - left & right - 39) */vec3(62.39f, 678.83f, -77.59f),
+    // Roof - left slope top
+    /* 218 (Roof - left slope top - 133) */vec3(150.46f, 875.79f, 678.86f),
+    /* 219 (Roof - left slope top - 135) */vec3(150.46f, 875.79f, -115.21f),
+    /* 220 (Roof - left slope top - 162) */vec3(-291.43f, 425.47f, 678.86f),
+    /* 221 (Roof - left slope top - 164) */vec3(-291.43f, 425.47f, -115.21f),
+    // Roof - right slope top
+    /* 222 (Roof - right slope top - 59) */vec3(547.33f, 425.47f, 678.86f),
+    /* 223 (Roof - right slope top - 61) */vec3(547.33f, 425.47f, -115.21f),
+    /* 224 (Roof - right slope top - 133) */vec3(150.46f, 875.79f, 678.86f),
+    /* 225 (Roof - right slope top - 135) */vec3(150.46f, 875.79f, -115.21f),
+    // Roof - left slope bottom
+    /* 226 (Roof - left slope bottom - 78) */vec3(149.63f, 848.02f, 636.31f),
+    /* 227 (Roof - left slope bottom - 85) */vec3(149.63f, 848.02f, 678.86f),
+    /* 228 (Roof - left slope bottom - 108) */vec3(149.63f, 848.02f, -64.89f),
+    /* 229 (Roof - left slope bottom - 110) */vec3(149.63f, 848.02f, -115.21f),
+    /* 230 (Roof - left slope bottom - 118) */vec3(-224.47f, 466.78f, 678.86f),
+    /* 231 (Roof - left slope bottom - 120) */vec3(-224.47f, 466.78f, 636.31f),
+    /* 232 (Roof - left slope bottom - 143) */vec3(-224.47f, 466.78f, -64.89f),
+    /* 233 (Roof - left slope bottom - 145) */vec3(-224.47f, 466.78f, -115.21f),
+    /* 234 (Roof - left slope bottom - 154) */vec3(-265.01f, 425.47f, -115.21f),
+    /* 235 (Roof - left slope bottom - 155) */vec3(-265.01f, 425.47f, 678.86f),
+    // Roof - right slope bottom
+    /* 236 (Roof - right slope bottom - 26) */vec3(517.49f, 425.47f, -115.21f),
+    /* 237 (Roof - right slope bottom - 35) */vec3(483.08f, 464.99f, -64.89f),
+    /* 238 (Roof - right slope bottom - 36) */vec3(483.08f, 464.99f, -115.21f),
+    /* 239 (Roof - right slope bottom - 44) */vec3(483.08f, 464.99f, 636.31f),
+    /* 240 (Roof - right slope bottom - 51) */vec3(483.08f, 464.99f, 678.86f),
+    /* 241 (Roof - right slope bottom - 53) */vec3(517.49f, 425.47f, 678.86f),
+    /* 242 (Roof - right slope bottom - 78) */vec3(149.63f, 848.02f, 636.31f),
+    /* 243 (Roof - right slope bottom - 85) */vec3(149.63f, 848.02f, 678.86f),
+    /* 244 (Roof - right slope bottom - 108) */vec3(149.63f, 848.02f, -64.89f),
+    /* 245 (Roof - right slope bottom - 110) */vec3(149.63f, 848.02f, -115.21f),
+    // Roof - front
+    /* 246 (Roof - front - 26) */vec3(517.49f, 425.47f, -115.21f),
+    /* 247 (Roof - front - 61) */vec3(547.33f, 425.47f, -115.21f),
+    /* 248 (Roof - front - 110) */vec3(149.63f, 848.02f, -115.21f),
+    /* 249 (Roof - front - 135) */vec3(150.46f, 875.79f, -115.21f),
+    /* 250 (Roof - front - 154) */vec3(-265.01f, 425.47f, -115.21f),
+    /* 251 (Roof - front - 164) */vec3(-291.43f, 425.47f, -115.21f),
+    // Roof - back
+    /* 252 (Roof - back - 53) */vec3(517.49f, 425.47f, 678.86f),
+    /* 253 (Roof - back - 59) */vec3(547.33f, 425.47f, 678.86f),
+    /* 254 (Roof - back - 85) */vec3(149.63f, 848.02f, 678.86f),
+    /* 255 (Roof - back - 133) */vec3(150.46f, 875.79f, 678.86f),
+    /* 256 (Roof - back - 155) */vec3(-265.01f, 425.47f, 678.86f),
+    /* 257 (Roof - back - 162) */vec3(-291.43f, 425.47f, 678.86f),
+    // Roof - bottom
+    /* 258 (Roof - bottom - 26) */vec3(517.49f, 425.47f, -115.21f),
+    /* 259 (Roof - bottom - 53) */vec3(517.49f, 425.47f, 678.86f),
+    /* 260 (Roof - bottom - 59) */vec3(547.33f, 425.47f, 678.86f),
+    /* 261 (Roof - bottom - 61) */vec3(547.33f, 425.47f, -115.21f),
+    /* 262 (Roof - bottom - 154) */vec3(-265.01f, 425.47f, -115.21f),
+    /* 263 (Roof - bottom - 155) */vec3(-265.01f, 425.47f, 678.86f),
+    /* 264 (Roof - bottom - 162) */vec3(-291.43f, 425.47f, 678.86f),
+    /* 265 (Roof - bottom - 164) */vec3(-291.43f, 425.47f, -115.21f),
+    // Chimney - outer - front & back
+    /* 266 (Chimney - outer - front & back - 22) */vec3(308.14f, 467.57f, 174.61f),
+    /* 267 (Chimney - outer - front & back - 31) */vec3(308.14f, 467.57f, 424.14f),
+    /* 268 (Chimney - outer - front & back - 37) */vec3(462.36f, 467.57f, 424.14f),
+    /* 269 (Chimney - outer - front & back - 39) */vec3(462.36f, 467.57f, 174.61f),
+    /* 270 (Chimney - outer - front & back - 48) */vec3(462.36f, 875.79f, 174.61f),
+    /* 271 (Chimney - outer - front & back - 50) */vec3(462.36f, 875.79f, 424.14f),
+    /* 272 (Chimney - outer - front & back - 53) */vec3(308.14f, 875.79f, 424.14f),
+    /* 273 (Chimney - outer - front & back - 55) */vec3(308.14f, 875.79f, 174.61f),
+    // Chimney - outer - left & right
+    /* 274 (Chimney - outer - left & right - 22) */vec3(308.14f, 467.57f, 174.61f),
+    /* 275 (Chimney - outer - left & right - 31) */vec3(308.14f, 467.57f, 424.14f),
+    /* 276 (Chimney - outer - left & right - 37) */vec3(462.36f, 467.57f, 424.14f),
+    /* 277 (Chimney - outer - left & right - 39) */vec3(462.36f, 467.57f, 174.61f),
+    /* 278 (Chimney - outer - left & right - 48) */vec3(462.36f, 875.79f, 174.61f),
+    /* 279 (Chimney - outer - left & right - 50) */vec3(462.36f, 875.79f, 424.14f),
+    /* 280 (Chimney - outer - left & right - 53) */vec3(308.14f, 875.79f, 424.14f),
+    /* 281 (Chimney - outer - left & right - 55) */vec3(308.14f, 875.79f, 174.61f),
+    // Chimney - outer - top
+    /* 282 (Chimney - outer - top - 48) */vec3(462.36f, 875.79f, 174.61f),
+    /* 283 (Chimney - outer - top - 49) */vec3(434.47f, 875.79f, 396.25f),
+    /* 284 (Chimney - outer - top - 50) */vec3(462.36f, 875.79f, 424.14f),
+    /* 285 (Chimney - outer - top - 51) */vec3(336.04f, 875.79f, 396.25f),
+    /* 286 (Chimney - outer - top - 52) */vec3(336.04f, 875.79f, 202.51f),
+    /* 287 (Chimney - outer - top - 53) */vec3(308.14f, 875.79f, 424.14f),
+    /* 288 (Chimney - outer - top - 54) */vec3(434.47f, 875.79f, 202.51f),
+    /* 289 (Chimney - outer - top - 55) */vec3(308.14f, 875.79f, 174.61f),
+    // Chimney - inner - top
+    /* 290 (Chimney - inner - top - 4) */vec3(434.47f, 853.6f, 396.25f),
+    /* 291 (Chimney - inner - top - 5) */vec3(434.47f, 853.6f, 202.51f),
+    /* 292 (Chimney - inner - top - 6) */vec3(336.04f, 853.6f, 396.25f),
+    /* 293 (Chimney - inner - top - 7) */vec3(336.04f, 853.6f, 202.51f),
+};
+// Per vertex
+const Material *const PLATFORM_HOUSE_MATERIALS[] = {
+    // Grass
+    &Constants::MATERIAL_GRASS,
+    &Constants::MATERIAL_GRASS,
+    &Constants::MATERIAL_GRASS,
+    &Constants::MATERIAL_GRASS,
+    &Constants::MATERIAL_GRASS,
+    &Constants::MATERIAL_GRASS,
+    &Constants::MATERIAL_GRASS,
+    &Constants::MATERIAL_GRASS,
+    &Constants::MATERIAL_GRASS,
+    &Constants::MATERIAL_GRASS,
+    &Constants::MATERIAL_GRASS,
+    &Constants::MATERIAL_GRASS,
+    &Constants::MATERIAL_ROAD,
+    &Constants::MATERIAL_ROAD,
+    &Constants::MATERIAL_ROAD,
+    &Constants::MATERIAL_ROAD,
+    &Constants::MATERIAL_ROAD,
+    &Constants::MATERIAL_ROAD,
+    &Constants::MATERIAL_ROAD,
+    &Constants::MATERIAL_ROAD,
+    &Constants::MATERIAL_GRASS,
+    &Constants::MATERIAL_GRASS,
+    &Constants::MATERIAL_GRASS,
+    &Constants::MATERIAL_GRASS,
+    &Constants::MATERIAL_GRASS,
+    &Constants::MATERIAL_GRASS,
+    &Constants::MATERIAL_GRASS,
+    &Constants::MATERIAL_GRASS,
+    &Constants::MATERIAL_GRASS,
+    &Constants::MATERIAL_GRASS,
+    &Constants::MATERIAL_GRASS,
+    &Constants::MATERIAL_GRASS,
+    &Constants::MATERIAL_GRASS,
+    &Constants::MATERIAL_GRASS,
+    &Constants::MATERIAL_GRASS,
+    &Constants::MATERIAL_GRASS,
+    &Constants::MATERIAL_GRASS,
+    &Constants::MATERIAL_GRASS,
+    &Constants::MATERIAL_GRASS,
+    &Constants::MATERIAL_GRASS,
+    &Constants::MATERIAL_WALLS,
+    &Constants::MATERIAL_WALLS,
+    &Constants::MATERIAL_WALLS,
+    &Constants::MATERIAL_WALLS,
+    &Constants::MATERIAL_WALLS,
+    &Constants::MATERIAL_WALLS,
+    &Constants::MATERIAL_WALLS,
+    &Constants::MATERIAL_WALLS,
+    &Constants::MATERIAL_WALLS,
+    &Constants::MATERIAL_WALLS,
+    &Constants::MATERIAL_WALLS,
+    &Constants::MATERIAL_WALLS,
+    &Constants::MATERIAL_WALLS,
+    &Constants::MATERIAL_WALLS,
+    &Constants::MATERIAL_WALLS,
+    &Constants::MATERIAL_WALLS,
+    &Constants::MATERIAL_WALLS,
+    &Constants::MATERIAL_WALLS,
+    &Constants::MATERIAL_WALLS,
+    &Constants::MATERIAL_WALLS,
+    &Constants::MATERIAL_WALLS,
+    &Constants::MATERIAL_WALLS,
+    &Constants::MATERIAL_WALLS,
+    &Constants::MATERIAL_WALLS,
+    &Constants::MATERIAL_WALLS,
+    &Constants::MATERIAL_WALLS,
+    &Constants::MATERIAL_DOOR,
+    &Constants::MATERIAL_DOOR,
+    &Constants::MATERIAL_DOOR,
+    &Constants::MATERIAL_DOOR,
+    &Constants::MATERIAL_FRAMES,
+    &Constants::MATERIAL_FRAMES,
+    &Constants::MATERIAL_FRAMES,
+    &Constants::MATERIAL_FRAMES,
+    &Constants::MATERIAL_FRAMES,
+    &Constants::MATERIAL_FRAMES,
+    &Constants::MATERIAL_FRAMES,
+    &Constants::MATERIAL_FRAMES,
+    &Constants::MATERIAL_FRAMES,
+    &Constants::MATERIAL_FRAMES,
+    &Constants::MATERIAL_FRAMES,
+    &Constants::MATERIAL_FRAMES,
+    &Constants::MATERIAL_FRAMES,
+    &Constants::MATERIAL_FRAMES,
+    &Constants::MATERIAL_FRAMES,
+    &Constants::MATERIAL_FRAMES,
+    &Constants::MATERIAL_FRAMES,
+    &Constants::MATERIAL_FRAMES,
+    &Constants::MATERIAL_FRAMES,
+    &Constants::MATERIAL_FRAMES,
+    &Constants::MATERIAL_FRAMES,
+    &Constants::MATERIAL_FRAMES,
+    &Constants::MATERIAL_FRAMES,
+    &Constants::MATERIAL_FRAMES,
+    &Constants::MATERIAL_FRAMES,
+    &Constants::MATERIAL_FRAMES,
+    &Constants::MATERIAL_FRAMES,
+    &Constants::MATERIAL_FRAMES,
+    &Constants::MATERIAL_FRAMES,
+    &Constants::MATERIAL_FRAMES,
+    &Constants::MATERIAL_FRAMES,
+    &Constants::MATERIAL_FRAMES,
+    &Constants::MATERIAL_WINDOWS,
+    &Constants::MATERIAL_WINDOWS,
+    &Constants::MATERIAL_WINDOWS,
+    &Constants::MATERIAL_WINDOWS,
+    &Constants::MATERIAL_WINDOWS,
+    &Constants::MATERIAL_WINDOWS,
+    &Constants::MATERIAL_WINDOWS,
+    &Constants::MATERIAL_WINDOWS,
+    &Constants::MATERIAL_WINDOWS,
+    &Constants::MATERIAL_WINDOWS,
+    &Constants::MATERIAL_WINDOWS,
+    &Constants::MATERIAL_WINDOWS,
+    &Constants::MATERIAL_WINDOWS,
+    &Constants::MATERIAL_WINDOWS,
+    &Constants::MATERIAL_WINDOWS,
+    &Constants::MATERIAL_WINDOWS,
+    &Constants::MATERIAL_FRAMES,
+    &Constants::MATERIAL_FRAMES,
+    &Constants::MATERIAL_FRAMES,
+    &Constants::MATERIAL_FRAMES,
+    &Constants::MATERIAL_FRAMES,
+    &Constants::MATERIAL_FRAMES,
+    &Constants::MATERIAL_FRAMES,
+    &Constants::MATERIAL_FRAMES,
+    &Constants::MATERIAL_FRAMES,
+    &Constants::MATERIAL_FRAMES,
+    &Constants::MATERIAL_FRAMES,
+    &Constants::MATERIAL_FRAMES,
+    &Constants::MATERIAL_FRAMES,
+    &Constants::MATERIAL_FRAMES,
+    &Constants::MATERIAL_FRAMES,
+    &Constants::MATERIAL_FRAMES,
+    &Constants::MATERIAL_FRAMES,
+    &Constants::MATERIAL_FRAMES,
+    &Constants::MATERIAL_FRAMES,
+    &Constants::MATERIAL_FRAMES,
+    &Constants::MATERIAL_FRAMES,
+    &Constants::MATERIAL_FRAMES,
+    &Constants::MATERIAL_FRAMES,
+    &Constants::MATERIAL_FRAMES,
+    &Constants::MATERIAL_FRAMES,
+    &Constants::MATERIAL_FRAMES,
+    &Constants::MATERIAL_FRAMES,
+    &Constants::MATERIAL_FRAMES,
+    &Constants::MATERIAL_FRAMES,
+    &Constants::MATERIAL_FRAMES,
+    &Constants::MATERIAL_FRAMES,
+    &Constants::MATERIAL_FRAMES,
+    &Constants::MATERIAL_FRAMES,
+    &Constants::MATERIAL_FRAMES,
+    &Constants::MATERIAL_FRAMES,
+    &Constants::MATERIAL_FRAMES,
+    &Constants::MATERIAL_FRAMES,
+    &Constants::MATERIAL_FRAMES,
+    &Constants::MATERIAL_FRAMES,
+    &Constants::MATERIAL_FRAMES,
+    &Constants::MATERIAL_FRAMES,
+    &Constants::MATERIAL_FRAMES,
+    &Constants::MATERIAL_FRAMES,
+    &Constants::MATERIAL_FRAMES,
+    &Constants::MATERIAL_FRAMES,
+    &Constants::MATERIAL_FRAMES,
+    &Constants::MATERIAL_FRAMES,
+    &Constants::MATERIAL_FRAMES,
+    &Constants::MATERIAL_FRAMES,
+    &Constants::MATERIAL_FRAMES,
+    &Constants::MATERIAL_FRAMES,
+    &Constants::MATERIAL_FRAMES,
+    &Constants::MATERIAL_FRAMES,
+    &Constants::MATERIAL_FRAMES,
+    &Constants::MATERIAL_FRAMES,
+    &Constants::MATERIAL_FRAMES,
+    &Constants::MATERIAL_FRAMES,
+    &Constants::MATERIAL_FRAMES,
+    &Constants::MATERIAL_FRAMES,
+    &Constants::MATERIAL_FRAMES,
+    &Constants::MATERIAL_FRAMES,
+    &Constants::MATERIAL_FRAMES,
+    &Constants::MATERIAL_FRAMES,
+    &Constants::MATERIAL_FRAMES,
+    &Constants::MATERIAL_FRAMES,
+    &Constants::MATERIAL_FRAMES,
+    &Constants::MATERIAL_FRAMES,
+    &Constants::MATERIAL_FRAMES,
+    &Constants::MATERIAL_FRAMES,
+    &Constants::MATERIAL_FRAMES,
+    &Constants::MATERIAL_FRAMES,
+    &Constants::MATERIAL_FRAMES,
+    &Constants::MATERIAL_FRAMES,
+    &Constants::MATERIAL_FRAMES,
+    &Constants::MATERIAL_FRAMES,
+    &Constants::MATERIAL_FRAMES,
+    &Constants::MATERIAL_FRAMES,
+    &Constants::MATERIAL_FRAMES,
+    &Constants::MATERIAL_FRAMES,
+    &Constants::MATERIAL_FRAMES,
+    &Constants::MATERIAL_FRAMES,
+    &Constants::MATERIAL_FRAMES,
+    &Constants::MATERIAL_FRAMES,
+    &Constants::MATERIAL_FRAMES,
+    &Constants::MATERIAL_FRAMES,
+    &Constants::MATERIAL_FRAMES,
+    &Constants::MATERIAL_FRAMES,
+    &Constants::MATERIAL_FRAMES,
+    &Constants::MATERIAL_FRAMES,
+    &Constants::MATERIAL_FRAMES,
+    &Constants::MATERIAL_FRAMES,
+    &Constants::MATERIAL_FRAMES,
+    &Constants::MATERIAL_FRAMES,
+    &Constants::MATERIAL_FRAMES,
+    &Constants::MATERIAL_FRAMES,
+    &Constants::MATERIAL_FRAMES,
+    &Constants::MATERIAL_FRAMES,
+    &Constants::MATERIAL_FRAMES,
+    &Constants::MATERIAL_FRAMES,
+    &Constants::MATERIAL_FRAMES,
+    &Constants::MATERIAL_ROOF,
+    &Constants::MATERIAL_ROOF,
+    &Constants::MATERIAL_ROOF,
+    &Constants::MATERIAL_ROOF,
+    &Constants::MATERIAL_ROOF,
+    &Constants::MATERIAL_ROOF,
+    &Constants::MATERIAL_ROOF,
+    &Constants::MATERIAL_ROOF,
+    &Constants::MATERIAL_ROOF,
+    &Constants::MATERIAL_ROOF,
+    &Constants::MATERIAL_ROOF,
+    &Constants::MATERIAL_ROOF,
+    &Constants::MATERIAL_ROOF,
+    &Constants::MATERIAL_ROOF,
+    &Constants::MATERIAL_ROOF,
+    &Constants::MATERIAL_ROOF,
+    &Constants::MATERIAL_ROOF,
+    &Constants::MATERIAL_ROOF,
+    &Constants::MATERIAL_ROOF,
+    &Constants::MATERIAL_ROOF,
+    &Constants::MATERIAL_ROOF,
+    &Constants::MATERIAL_ROOF,
+    &Constants::MATERIAL_ROOF,
+    &Constants::MATERIAL_ROOF,
+    &Constants::MATERIAL_ROOF,
+    &Constants::MATERIAL_ROOF,
+    &Constants::MATERIAL_ROOF,
+    &Constants::MATERIAL_ROOF,
+    &Constants::MATERIAL_ROOF,
+    &Constants::MATERIAL_ROOF,
+    &Constants::MATERIAL_ROOF,
+    &Constants::MATERIAL_ROOF,
+    &Constants::MATERIAL_ROOF,
+    &Constants::MATERIAL_ROOF,
+    &Constants::MATERIAL_ROOF,
+    &Constants::MATERIAL_ROOF,
+    &Constants::MATERIAL_ROOF,
+    &Constants::MATERIAL_ROOF,
+    &Constants::MATERIAL_ROOF,
+    &Constants::MATERIAL_ROOF,
+    &Constants::MATERIAL_ROOF,
+    &Constants::MATERIAL_ROOF,
+    &Constants::MATERIAL_ROOF,
+    &Constants::MATERIAL_ROOF,
+    &Constants::MATERIAL_ROOF,
+    &Constants::MATERIAL_ROOF,
+    &Constants::MATERIAL_ROOF,
+    &Constants::MATERIAL_ROOF,
+    &Constants::MATERIAL_CHIMNEY,
+    &Constants::MATERIAL_CHIMNEY,
+    &Constants::MATERIAL_CHIMNEY,
+    &Constants::MATERIAL_CHIMNEY,
+    &Constants::MATERIAL_CHIMNEY,
+    &Constants::MATERIAL_CHIMNEY,
+    &Constants::MATERIAL_CHIMNEY,
+    &Constants::MATERIAL_CHIMNEY,
+    &Constants::MATERIAL_CHIMNEY,
+    &Constants::MATERIAL_CHIMNEY,
+    &Constants::MATERIAL_CHIMNEY,
+    &Constants::MATERIAL_CHIMNEY,
+    &Constants::MATERIAL_CHIMNEY,
+    &Constants::MATERIAL_CHIMNEY,
+    &Constants::MATERIAL_CHIMNEY,
+    &Constants::MATERIAL_CHIMNEY,
+    &Constants::MATERIAL_CHIMNEY,
+    &Constants::MATERIAL_CHIMNEY,
+    &Constants::MATERIAL_CHIMNEY,
+    &Constants::MATERIAL_CHIMNEY,
+    &Constants::MATERIAL_CHIMNEY,
+    &Constants::MATERIAL_CHIMNEY,
+    &Constants::MATERIAL_CHIMNEY,
+    &Constants::MATERIAL_CHIMNEY,
+    &Constants::MATERIAL_CHIMNEY_INNER,
+    &Constants::MATERIAL_CHIMNEY_INNER,
+    &Constants::MATERIAL_CHIMNEY_INNER,
+    &Constants::MATERIAL_CHIMNEY_INNER,
+};
+const GLuint PLATFORM_HOUSE_INDICES[] = {
+    // Grass top
+    1, 0, 2, // 32, 43, 65
+    1, 2, 3, // 32, 65, 30
+    3, 2, 4, // 30, 65, 64
+    9, 3, 8, // 29, 30, 28
+    8, 3, 4, // 28, 30, 64
+    10, 8, 4, // 27, 28, 64
+    5, 11, 10, // 25, 35, 27
+    5, 10, 4,// 25, 27, 64
+    7, 5, 4, // 58, 25, 64
+    7, 6, 5, // 58, 34, 25
+    // Road top
+    18, 17, 16, // 34, 32, 30
+    18, 16, 12, // 34, 30, 25
+    19, 15, 14, // 35, 29, 28
+    19, 14, 13, // 35, 28, 27
+    // Grass front
+    23, 21, 20, // 50, 50, 43
+    23, 20, 22, // 59, 43, 58
+    // Grass right
+    27, 25, 24, // 66, 59, 58
+    27, 24, 26, // 66, 58, 64
+    // Grass back
+    31, 30, 28, // 67, 66, 64
+    31, 28, 29, // 67, 64, 65
+    // Grass left
+    33, 35, 34, // 50, 67, 65
+    33, 34, 32, // 50, 65, 43
+    // Grass bottom
+    38, 39, 36, // 66, 67, 50
+    38, 36, 37, // 66, 50, 59
+    // House front
+    44, 51, 43, // 58, 79, 56
+    43, 51, 46, // 56, 79, 61
+    42, 43, 46, // 54, 56, 81
+    42, 46, 41, // 54, 81, 51
+    41, 46, 40, // 61, 81, 50
+    52, 43, 42, // 55, 56, 54
+    47, 43, 52, // 62, 56, 55
+    47, 48, 43, // 62, 63, 56
+    47, 49, 48, // 62, 64, 63
+    47, 50, 49, // 62, 65, 64
+    47, 52, 45, // 62, 55, 59
+    47, 45, 40, // 62, 59, 50
+    45, 41, 40, // 59, 51, 50
+    // House right
+    54, 55, 56, // 29, 62, 65
+    54, 53, 55, // 29, 62, 27
+    // House back
+    61, 58, 57, // 76, 29, 27
+    61, 57, 60, // 76, 27, 74
+    60, 57, 59, // 74, 27, 30
+    // House left
+    64, 63, 62, // 79, 76, 74
+    64, 62, 65, // 79, 74, 81
+    // Door
+    67, 68, 66, // 5, 6, 4
+    67, 69, 68, // 5, 7, 6
+    // Door frame - front
+    74, 75, 73, // 46, 47, 39
+    73, 75, 72, // 39, 47, 38
+    71, 74, 73, // 29, 46, 39
+    71, 77, 74, // 29, 55, 46
+    71, 76, 77, // 29, 54, 55
+    71, 70, 76, // 29, 23, 54
+    // Door frame - top
+    79, 80, 81, // 29, 37, 39
+    78, 80, 79, // 28, 29, 37
+    // Door frame - left
+    85, 84, 83, // 39, 38, 37
+    83, 84, 82, // 37, 38, 36
+    89, 88, 87, // 55, 54, 53
+    87, 88, 86, // 53, 54, 52
+    // Door frame - right
+    90, 93, 91, // 21, 29, 23
+    92, 90, 93, // 28, 21, 29
+    96, 95, 97, // 46, 45, 47
+    94, 95, 96, // 44, 45, 46
+    // Door frame - top
+    101, 100, 99, // 55, 53, 46
+    100, 98, 99, // 53, 46, 44
+    // Window - bottom left
+    102, 105, 104, // 4, 7, 6
+    103, 105, 102, // 5, 7, 4
+    // Window - bottom right
+    106, 109, 108, // 4, 7, 6
+    107, 109, 106, // 5, 7, 4
+    // Window - top left
+    110, 113, 112, // 4, 7, 6
+    111, 113, 110, // 5, 7, 4
+    // Window - top right
+    114, 117, 116, // 4, 7, 6
+    115, 117, 114, // 5, 7, 4
+    // Window - inner frame - front
+    125, 127, 128, // 102, 111, 117
+    125, 128, 126, // 102, 117, 103
+    124, 129, 122, // 93, 119, 66
+    124, 122, 121, // 93, 66, 55
+    124, 121, 118, // 93, 55, 37
+    124, 118, 123, // 93, 37, 81
+    118, 121, 120, // 37, 55, 54
+    118, 120, 119, // 37, 54, 39
+    // Window - inner frame - bottom
+    138, 139, 140, // 92, 93, 101
+    141, 140, 139, // 93, 101, 103
+    142, 143, 144, // 116, 117, 118
+    145, 144, 143, // 117, 118, 119
+    136, 137, 130, // 82, 84, 21
+    131, 130, 137, // 84, 21, 39
+    133, 131, 137, // 84, 39, 54
+    135, 133, 137, // 84, 54, 67
+    133, 134, 132, // 52, 54, 65
+    135, 134, 133, // 54, 65, 67
+    // Window - inner frame - left
+    155, 160, 161,     // 71, 118, 119
+    161, 155, 154, // 71, 119, 68
+    154, 161, 152,  // 66, 119, 68
+    152, 153, 154, // 66, 67, 68
+    152, 151, 153, // 66, 65, 67
+    150, 151, 152, // 64, 65, 66
+    156, 157, 158, // 100, 101, 102
+    157, 159, 158, // 101, 103, 102
+    146, 147, 148, // 20, 21, 37
+    147, 149, 148, // 21, 39, 37
+    // Window - inner frame - right
+    175, 177, 174, // 111, 117, 109
+    174, 177, 176, // 109, 117, 116
+    165, 164, 163, // 55, 54, 53
+    163, 164, 162, // 53, 54, 52
+    171, 173, 170, // 87, 93, 86
+    170, 173, 172, // 86, 93, 92
+    171, 169, 173, // 87, 84, 93
+    173, 169, 167, // 93, 84, 81
+    167, 169, 168, // 81, 84, 82
+    167, 168, 166, // 81, 82, 80
+    // Window - outer frame - front
+    184, 178, 185, // 37, 9, 39
+    184, 181, 178, // 37, 14, 9
+    184, 180, 181, // 37, 12, 14
+    184, 183, 180, // 37, 31, 12
+    183, 182, 180, // 31, 22, 12
+    180, 182, 179, // 12, 22, 11
+    179, 182, 185, // 11, 22, 39
+    178, 179, 185, // 9, 11, 39
+    // Window - inner frame - top
+    191, 192, 190, // 13, 14, 12
+    189, 191, 190, // 11, 13, 12
+    188, 189, 190, // 10, 11, 12
+    188, 187, 189, // 10, 9, 11
+    188, 186, 187, // 10, 8, 9
+    186, 193, 187, // 8, 15, 9
+    // Window - inner frame - bottom - left
+    194, 195, 196, // 4, 5, 6
+    195, 197, 196, // 5, 7, 6
+    // Window - inner frame - bottom - right
+    198, 199, 200, // 4, 5, 6
+    199, 201, 200, // 5, 7, 6
+    // Window - outer frame - bottom & top
+    204, 202, 203, // 29, 22, 20
+    205, 204, 203, // 31, 29, 22
+    206, 209, 208, // 36, 39, 38
+    209, 206, 207, // 37, 36, 39
+    // Window - outer frame - left & right
+    212, 215, 214, // 36, 37, 29
+    215, 212, 213, // 37, 29, 31
+    211, 216, 217,  // 39, 38, 22
+    216, 211, 210, // 38, 22, 20
+    // Roof - left slope top
+    219, 221, 218, // 135, 164, 133
+    218, 221, 220, // 133, 164, 162
+    // Roof - right slope top
+    224, 222, 225, // 133, 59, 135
+    222, 223, 225, // 59, 61, 135
+    // Roof - left slope bottom
+    228, 233, 229, // 108, 145, 110
+    228, 232, 233, // 108, 143, 145
+    234, 233, 235, // 154, 145, 155
+    233, 235, 230, // 145, 155, 118
+    230, 231, 226, // 118, 120, 78
+    230, 226, 227, // 118, 78, 85
+    // Roof - right slope bottom
+    237, 244, 245, // 35, 108, 110
+    237, 245, 237, // 35, 110, 35
+    240, 241, 236, // 51, 53, 26
+    240, 238, 236, // 51, 36, 26
+    243, 242, 240, // 85, 78, 51
+    242, 240, 239, // 78, 51, 44
+    // Roof - front
+    249, 248, 250, // 135, 110, 154
+    249, 250, 251,  // 135, 154, 164
+    247, 246, 249, // 61, 26, 135
+    246, 248, 249, // 26, 110, 135
+    // Roof - back
+    255, 254, 252, // 133, 85, 53
+    255, 252, 253, // 133, 53, 59
+    257, 256, 254, // 162, 155, 85
+    257, 254, 255, // 162, 85, 133
+    // Roof - bottom
+    260, 259, 258, // 59, 53, 26
+    260, 258, 261, // 59, 26, 61
+    265, 262, 264, // 164, 154, 162
+    262, 263, 264, // 154, 155, 162
+    // Chimney - outer - front & back
+    270, 269, 266, // 48, 39, 22
+    270, 266, 273, // 48, 22, 55
+    272, 267, 268, // 53, 31, 37
+    272, 268, 271, // 53, 37, 50
+    // Chimney - outer - left & right
+    279, 276, 278, // 50, 37, 48
+    276, 277, 278, // 37, 39, 48
+    281, 274, 275, // 55, 22, 31
+    281, 275, 280, // 55, 31, 53
+    // Chimney - outer - top
+    283, 284, 282, // 49, 50, 48
+    283, 282, 288, // 49, 48, 54
+    288, 282, 286, // 54, 48, 52
+    282, 286, 289, // 48, 52, 55
+    286, 289, 287, // 52, 55, 53
+    286, 287, 285, // 52, 53, 51
+    285, 287, 284, // 51, 53, 50
+    285, 284, 283, // 51, 50, 49
+    // Chimney - inner - top
+    292, 290, 291, // 6, 4, 5
+    292, 291, 293, // 6, 5, 7
+};
+const size_t PLATFORM_INDEX_COUNT = 78; // The house's indices follow
 
-                indices[6 * vertexIndex] = firstIndex + indexA;
-                indices[6 * vertexIndex + 1] = firstIndex + indexB;
-                indices[6 * vertexIndex + 2] = firstIndex + indexC;
+static_assert(size(PLATFORM_HOUSE_MATERIALS) == size(PLATFORM_HOUSE_VERTICES), "A material per vertex");
 
-                indices[6 * vertexIndex + 3] = firstIndex + indexA;
-                indices[6 * vertexIndex + 4] = firstIndex + indexC;
-                indices[6 * vertexIndex + 5] = firstIndex + indexD;
+void appendPlatformAndHouseMesh(MeshBuilder &builder) {
+    // The temporaries are only needed until the tables are packed, so they share the builder's memory
+    auto *resource = builder.getResource();
+    const span<const vec3> vertices(PLATFORM_HOUSE_VERTICES);
+    const span<const Material *const> materials(PLATFORM_HOUSE_MATERIALS);
+    const span<const GLuint> indices(PLATFORM_HOUSE_INDICES);
+
+    // Materials
+    pmr::vector<GLubyte> materialIds(vertices.size(), resource);
+    for (auto i = 0; i < vertices.size(); i++) {
+        materialIds[i] = materialTable.getId(*materials[i]);
+    }
+
+    // Set the normals - flat, so every vertex takes the normal of the last triangle using it
+    const auto triangleCount = indices.size() / 3;
+    pmr::vector<vec3> faceNormals(triangleCount, resource);
+    for (auto triangle = 0; triangle < triangleCount; triangle++) {
+        auto A = vertices[indices[3 * triangle]];
+        auto B = vertices[indices[3 * triangle + 1]];
+        auto C = vertices[indices[3 * triangle + 2]];
+
+        auto AB = B - A;
+        auto AC = C - A;
+        faceNormals[triangle] = normalize(glm::cross(AB, AC));
+    }
+    pmr::vector<GLint> lastTriangles(vertices.size(), -1, resource);
+    for (auto i = 0; i < indices.size(); i++) {
+        lastTriangles[indices[i]] = (GLint) (i / 3);
+    }
+
+    // Submeshes - the platform and the house are each split into their matte triangles and the rest, so the matte
+    // ones can be drawn without specular
+    const auto isMatteTriangle = [&](GLuint triangle) {
+        for (auto corner = 0; corner < 3; corner++) {
+            if (materials[indices[3 * triangle + corner]]->shininess > MATTE_SHININESS) {
+                return false;
             }
         }
+        return true;
+    };
+    pmr::vector<GLuint> triangleOrder(triangleCount, resource);
+    iota(triangleOrder.begin(), triangleOrder.end(), 0);
+    const auto platformEnd = triangleOrder.begin() + PLATFORM_INDEX_COUNT / 3;
+    const auto platformMatteEnd = stable_partition(triangleOrder.begin(), platformEnd, isMatteTriangle);
+    const auto houseMatteEnd = stable_partition(platformEnd, triangleOrder.end(), isMatteTriangle);
+
+    builder.reserve(MeshSize{vertices.size(), indices.size()});
+    const auto region = builder.appendRegion(MeshSize{vertices.size(), 0});
+    const decltype(platformEnd) splits[] = {
+            triangleOrder.begin(), platformMatteEnd, platformEnd, houseMatteEnd, triangleOrder.end()
     };
+    for (auto i = 0; i + 1 < size(splits); i++) {
+        if (splits[i] != splits[i + 1]) {
+            builder.beginRange();
+            builder.appendIndices(3 * (splits[i + 1] - splits[i]));
+            builder.endRange();
+        }
+    }
+
+    // Pack straight into the builder
+    for (auto i = 0; i < vertices.size(); i++) {
+        const auto normal = lastTriangles[i] >= 0 ? faceNormals[lastTriangles[i]] : vec3(0.0f);
+        region.vertices[i] = VertexFormat::pack(vertices[i], normal, materialIds[i]);
+    }
+    for (auto i = 0; i < indices.size(); i++) {
+        region.indices[i] = region.baseVertex + indices[3 * triangleOrder[i / 3] + i % 3];
+    }
+}
+
+// Tessellation levels - level 0 is the full detail, each following level has roughly half the triangles
+constexpr int TESSELLATION_LEVEL_COUNT = 4;
+constexpr int SPHERE_PARALLELS[TESSELLATION_LEVEL_COUNT] = {10, 7, 5, 3};
+constexpr int SPHERE_MERIDIANS[TESSELLATION_LEVEL_COUNT] = {20, 14, 10, 6};
+constexpr int CYLINDER_PARALLELS[TESSELLATION_LEVEL_COUNT] = {7, 3, 1, 1};
+constexpr int CYLINDER_MERIDIANS[TESSELLATION_LEVEL_COUNT] = {25, 16, 10, 6};
+
+MeshSize getSphereMeshSize(int tessellationLevel) {
+    const auto parallels = (size_t) SPHERE_PARALLELS[tessellationLevel];
+    const auto meridians = (size_t) SPHERE_MERIDIANS[tessellationLevel];
+    return MeshSize{(parallels + 1) * meridians, 6 * parallels * meridians};
+}
+
+MeshSize getCylinderMeshSize(int tessellationLevel) {
+    const auto parallels = (size_t) CYLINDER_PARALLELS[tessellationLevel];
+    const auto meridians = (size_t) CYLINDER_MERIDIANS[tessellationLevel];
+    return MeshSize{(parallels + 1) * meridians, 6 * parallels * meridians};
+}
+
+MeshSize getTreeMeshSize(int tessellationLevel) {
+    return getSphereMeshSize(tessellationLevel) + getCylinderMeshSize(tessellationLevel);
+}
+
+template<int LEVEL>
+void generateSphereMesh(MeshRegion region, vec3 center, float radius, GLubyte material) {
+    using Table = SphereTable<SPHERE_PARALLELS[LEVEL], SPHERE_MERIDIANS[LEVEL]>;
+
+    // Everything but the position & normal is the same for every vertex
+    const auto vertexTemplate = VertexFormat::pack(center, vec3(0.0f), material);
+    for (auto i = 0; i < Table::VERTEX_COUNT; i++) {
+        auto &vertex = region.vertices[i];
+        vertex = vertexTemplate;
+        vertex.position = center + radius * vec3(Table::POSITIONS[3 * i], Table::POSITIONS[3 * i + 1],
+                                                 Table::POSITIONS[3 * i + 2]);
+        vertex.normal = Table::PACKED_NORMALS[i];
+    }
+    for (auto i = 0; i < Table::INDEX_COUNT; i++) {
+        region.indices[i] = region.baseVertex + Table::INDICES[i];
+    }
+}
+
+void generateSphereMesh(MeshRegion region, vec3 center, float radius, const Material &material,
+                        int tessellationLevel = 0) {
+    static_assert(TESSELLATION_LEVEL_COUNT == 4, "One case per tessellation level");
+
+    const auto materialId = materialTable.getId(material);
+    switch (tessellationLevel) {
+        case 0:
+            generateSphereMesh<0>(region, center, radius, materialId);
+            break;
+        case 1:
+            generateSphereMesh<1>(region, center, radius, materialId);
+            break;
+        case 2:
+            generateSphereMesh<2>(region, center, radius, materialId);
+            break;
+        default:
+            generateSphereMesh<3>(region, center, radius, materialId);
+            break;
+    }
+}
+
+template<int LEVEL>
+void generateCylinderMesh(MeshRegion region, vec3 center, float radius, float height, GLubyte material) {
+    using Table = CylinderTable<CYLINDER_PARALLELS[LEVEL], CYLINDER_MERIDIANS[LEVEL]>;
 
-    return Mesh(firstIndex, vertices, colors, shininesses, indices, normals);
+    const vec3 scale(radius, height, radius);
+    const auto vertexTemplate = VertexFormat::pack(center, vec3(0.0f), material);
+    for (auto i = 0; i < Table::VERTEX_COUNT; i++) {
+        const auto offset = scale * vec3(Table::POSITIONS[3 * i], Table::POSITIONS[3 * i + 1],
+                                         Table::POSITIONS[3 * i + 2]);
+
+        auto &vertex = region.vertices[i];
+        vertex = vertexTemplate;
+        vertex.position = center + offset;
+        vertex.normal = VertexFormat::packNormal(offset);
+    }
+    for (auto i = 0; i < Table::INDEX_COUNT; i++) {
+        region.indices[i] = region.baseVertex + Table::INDICES[i];
+    }
+}
+
+void generateCylinderMesh(MeshRegion region, vec3 center, float radius, float height, const Material &material,
+                          int tessellationLevel = 0) {
+    static_assert(TESSELLATION_LEVEL_COUNT == 4, "One case per tessellation level");
+
+    const auto materialId = materialTable.getId(material);
+    switch (tessellationLevel) {
+        case 0:
+            generateCylinderMesh<0>(region, center, radius, height, materialId);
+            break;
+        case 1:
+            generateCylinderMesh<1>(region, center, radius, height, materialId);
+            break;
+        case 2:
+            generateCylinderMesh<2>(region, center, radius, height, materialId);
+            break;
+        default:
+            generateCylinderMesh<3>(region, center, radius, height, materialId);
+            break;
+    }
 }
 
-Mesh createTreeMesh(GLuint firstIndex, vec3 position) {
-    const auto TREE_LEAVES_RADIUS = 225.0f;
-    const auto TREE_LEAVES_SHININESS = 4.0f;
-    const auto TREE_TRUNK_HEIGHT = 325.0f;
-    const auto TREE_TRUNK_RADIUS = 35.0f;
-    const auto TREE_TRUNK_SHININESS = 2.0f;
+// Tree
+const float TREE_LEAVES_RADIUS = 225.0f;
+const float TREE_TRUNK_HEIGHT = 325.0f;
+const float TREE_TRUNK_RADIUS = 35.0f;
+// The trees on the platform, the forest is around it
+const vec3 PLATFORM_TREE_POSITIONS[] = {vec3(-450.0f, 0.0f, -600.0f), vec3(-750.0f, 0.0f, 500.0f)};
 
+// Fills a region of getTreeMeshSize(tessellationLevel)
+void generateTreeMesh(MeshRegion region, vec3 position, int tessellationLevel = 0) {
     const vec3 treeLeavesCenter(position.x, position.y + TREE_TRUNK_HEIGHT + TREE_LEAVES_RADIUS / 2, position.z);
-    const auto treeLeavesMesh = createSphereMesh(
-            firstIndex,
+    generateSphereMesh(
+            region,
             treeLeavesCenter, TREE_LEAVES_RADIUS,
-            Constants::COLOR_TREE_LEAVES, TREE_LEAVES_SHININESS
+            Constants::MATERIAL_TREE_LEAVES,
+            tessellationLevel
     );
 
     const vec3 treeTrunkCenter(position.x, position.y + TREE_TRUNK_HEIGHT / 2.0f, position.z);
-    const auto treeTrunkMesh = createCylinderMesh(
-            treeLeavesMesh.firstIndex + treeLeavesMesh.vertices.size(),
+    generateCylinderMesh(
+            region.advanced(getSphereMeshSize(tessellationLevel)),
             treeTrunkCenter, TREE_TRUNK_RADIUS, TREE_TRUNK_HEIGHT,
-            Constants::COLOR_TREE_TRUNK, TREE_TRUNK_SHININESS);
-
-    return combineMeshes(
-            {
-                    treeLeavesMesh,
-                    treeTrunkMesh
-            }
+            Constants::MATERIAL_TREE_TRUNK,
+            tessellationLevel
     );
 }
 
-void initializeScene() {
-    const auto platformAndHouseMesh = createPlatformAndHouseMesh();
-    const auto frontTreeMesh = createTreeMesh(
-            platformAndHouseMesh.firstIndex + platformAndHouseMesh.vertices.size(),
-            vec3(-450.0f, 0.0f, -600.0f)
-    );
-    const auto backTreeMesh = createTreeMesh(
-            frontTreeMesh.firstIndex + frontTreeMesh.vertices.size(),
-            vec3(-750.0f, 0.0f, 500.0f)
-    );
-    vector<Mesh> meshes = {
-            platformAndHouseMesh,
-            frontTreeMesh,
-            backTreeMesh
+void reportMeshOptimization(const string &name, const MeshOptimizationStats &stats) {
+    cout << "Index optimization (" << name << "): "
+         << "ACMR " << stats.before.acmr << " -> " << stats.after.acmr << ", "
+         << "ATVR " << stats.before.atvr << " -> " << stats.after.atvr << ", "
+         << stats.degenerateTriangles << " degenerate triangles removed, "
+         << stats.vertexCountBefore << " -> " << stats.vertexCountAfter << " vertices" << endl;
+}
+
+pmr::memory_resource *getSceneResource() {
+    return isSceneArenaEnabled ? &sceneArena : pmr::get_default_resource();
+}
+
+void reportMeshBuilder(const string &name, const MeshBuilderStats &stats) {
+    cout << "Mesh builder (" << name << "): " << stats.allocations << " allocations, "
+         << stats.copiedElements << " elements copied on growth" << endl;
+}
+
+// Welding & index optimization, in place
+void prepareMesh(const string &name, Mesh &mesh) {
+    if (isWeldingEnabled) {
+        reportWelding(name, MeshOptimizer::weld(mesh.vertices, mesh.indices));
+    }
+    if (isIndexOptimizationEnabled) {
+        reportMeshOptimization(name, MeshOptimizer::optimize(mesh.vertices, mesh.indices, mesh.drawRanges));
+    }
+}
+
+void reportSubdivision(const string &name, const SubdivisionStats &stats) {
+    cout << "Subdivision (" << name << "): " << stats.triangleCountBefore << " -> " << stats.triangleCountAfter
+         << " triangles, " << stats.vertexCountBefore << " -> " << stats.vertexCountAfter << " vertices" << endl;
+}
+
+void reportLightBake(const string &name, const LightBaker &baker, const LightBakeStats &stats) {
+    cout << "Light baking (" << name << "): " << stats.vertexCount << " vertices, " << stats.rayCount
+         << " rays against " << baker.getOccluderTriangleCount() << " triangles in " << stats.milliseconds
+         << " ms on " << threadPool.getThreadCount() << " threads" << endl;
+}
+
+// The world is occluded by itself and the platform trees. The forest depends on --trees, so it isn't part of the
+// cached bake, and neither are the trees' shadows on each other - each instance only occludes itself.
+void bakeLighting(Mesh &worldMesh, Mesh &unitTreeMesh) {
+    const auto worldView = worldMesh.view();
+    const auto unitTreeView = unitTreeMesh.view();
+
+    LightBaker worldBaker;
+    for (const auto &range: worldView.drawRanges) {
+        worldBaker.addOccluders(worldView, range);
+    }
+    for (const auto &position: PLATFORM_TREE_POSITIONS) {
+        worldBaker.addOccluders(unitTreeView, unitTreeView.drawRanges[0], position);
+    }
+    worldBaker.buildOccluders();
+    reportLightBake("world", worldBaker, worldBaker.bake(threadPool, worldMesh.vertices, true, lightPosition));
+
+    // Every level of detail is occluded by the most detailed one
+    LightBaker treeBaker;
+    treeBaker.addOccluders(unitTreeView, unitTreeView.drawRanges[0]);
+    treeBaker.buildOccluders();
+    reportLightBake("trees", treeBaker, treeBaker.bake(threadPool, unitTreeMesh.vertices, false, lightPosition));
+}
+
+// Shapes generated per second for every tessellation level, on one thread
+void benchmarkShapes() {
+    const auto BENCHMARK_DURATION = 0.25f; // Seconds per shape & level
+
+    const auto measure = [&](const char *name, int level, MeshSize size, const function<void(MeshRegion)> &generate) {
+        MeshBuilder builder;
+        const auto region = builder.appendRegion(size);
+
+        auto shapeCount = 0;
+        float elapsed = 0.0f;
+        const auto start = chrono::steady_clock::now();
+        while (elapsed < BENCHMARK_DURATION) {
+            for (auto i = 0; i < 100; i++) {
+                generate(region);
+            }
+            shapeCount += 100;
+            elapsed = chrono::duration<float>(chrono::steady_clock::now() - start).count();
+        }
+        cout << "  " << name << " level " << level << " (" << size.vertexCount << " vertices): "
+             << (float) shapeCount / elapsed << " shapes/s" << endl;
     };
 
-    const auto worldMesh = combineMeshes(meshes);
+    cout << "Shape generation:" << endl;
+    for (auto level = 0; level < TESSELLATION_LEVEL_COUNT; level++) {
+        measure("sphere", level, getSphereMeshSize(level), [level](MeshRegion region) {
+            generateSphereMesh(region, vec3(1.0f, 2.0f, 3.0f), 225.0f, Constants::MATERIAL_TREE_LEAVES, level);
+        });
+    }
+    for (auto level = 0; level < TESSELLATION_LEVEL_COUNT; level++) {
+        measure("cylinder", level, getCylinderMeshSize(level), [level](MeshRegion region) {
+            generateCylinderMesh(region, vec3(1.0f, 2.0f, 3.0f), 35.0f, 325.0f, Constants::MATERIAL_TREE_TRUNK,
+                                 level);
+        });
+    }
+}
+
+// Levels of detail - one unit tree per tessellation level, stored back to back. Every level is its own job.
+void generateTreeLods(MeshBuilder &builder, JobCounter &jobs) {
+    MeshSize unitTreeSize;
+    for (auto level = 0; level < TESSELLATION_LEVEL_COUNT; level++) {
+        unitTreeSize = unitTreeSize + getTreeMeshSize(level);
+    }
+    builder.reserve(unitTreeSize);
+    for (auto level = 0; level < TESSELLATION_LEVEL_COUNT; level++) {
+        builder.beginRange();
+        const auto region = builder.appendRegion(getTreeMeshSize(level));
+        builder.endRange();
+
+        threadPool.submit(jobs, [region, level] {
+            generateTreeMesh(region, vec3(0.0f, 0.0f, 0.0f), level);
+        });
+    }
+}
+
+// Forest - random positions outside the platform. Every chunk has its own fixed seed, so the forest is the same
+// for any number of threads.
+void generateForest(vector<MeshInstance> &instances, JobCounter &jobs) {
+    const auto FOREST_DENSITY = 400.0f; // Average distance between trees
+    const auto FOREST_CHUNK_SIZE = 4096;
+    const auto PLATFORM_MIN = vec2(-1300.0f, -1200.0f);
+    const auto PLATFORM_MAX = vec2(1150.0f, 1200.0f);
+    const auto forestHalfSize = 0.5f * FOREST_DENSITY * sqrtf((float) forestTreeCount) + PLATFORM_MAX.x;
+
+    instances.resize(forestTreeCount);
+    for (auto chunkStart = 0; chunkStart < forestTreeCount; chunkStart += FOREST_CHUNK_SIZE) {
+        const auto chunkEnd = std::min(chunkStart + FOREST_CHUNK_SIZE, forestTreeCount);
+        threadPool.submit(jobs, [&instances, chunkStart, chunkEnd, forestHalfSize, PLATFORM_MIN, PLATFORM_MAX] {
+            mt19937 random(1152 + chunkStart / FOREST_CHUNK_SIZE);
+            uniform_real_distribution<float> positionDistribution(-forestHalfSize, forestHalfSize);
+            uniform_real_distribution<float> scaleDistribution(0.7f, 1.3f);
+            uniform_real_distribution<float> rotationDistribution(0.0f, 2.0f * (float) M_PI);
+            uniform_real_distribution<float> tintDistribution(0.85f, 1.0f);
+            for (auto i = chunkStart; i < chunkEnd;) {
+                const auto x = positionDistribution(random);
+                const auto z = positionDistribution(random);
+                if (x > PLATFORM_MIN.x && x < PLATFORM_MAX.x && z > PLATFORM_MIN.y && z < PLATFORM_MAX.y) {
+                    continue;
+                }
+
+                instances[i] = InstancedMesh::makeInstance(
+                        vec3(x, 0.0f, z),
+                        scaleDistribution(random),
+                        rotationDistribution(random),
+                        vec3(tintDistribution(random), 1.0f, tintDistribution(random))
+                );
+                i++;
+            }
+        });
+    }
+}
+
+void initializeTrees(const MeshView &unitTreeMesh, const vector<MeshInstance> &forestInstances) {
+    unitTreeBounds = unitTreeMesh.drawRanges[0].bounds;
+    trees.initialize(unitTreeMesh.vertices, unitTreeMesh.vertexCount, unitTreeMesh.indices, unitTreeMesh.indexCount,
+                     unitTreeMesh.drawRanges);
+    auto maxShininess = 0.0f;
+    for (const auto &lod: unitTreeMesh.drawRanges) {
+        maxShininess = std::max(maxShininess, getMaxShininess(unitTreeMesh, lod));
+    }
+    // The instances are rotated, so only their occlusion is baked
+    treeVariant = selectShaderVariant(maxShininess,
+                                      isLightBakingEnabled ? BakedLighting::OCCLUSION : BakedLighting::NONE);
+    treeMaterial = getPrimaryMaterial(unitTreeMesh, unitTreeMesh.drawRanges[0]);
+
+    for (const auto &position: PLATFORM_TREE_POSITIONS) {
+        trees.addInstance(InstancedMesh::makeInstance(position));
+    }
+    for (const auto &instance: forestInstances) {
+        trees.addInstance(instance);
+    }
+
+    cout << "Trees: " << trees.getInstanceCount() << " instances of "
+         << trees.getVertexCount() << " vertices (" << trees.getLodCount() << " levels of detail), "
+         << trees.getInstanceCount() * sizeof(MeshInstance) << " bytes of instance data" << endl;
+}
+
+// Warm lamps at about a lamp per LAMP_SPACING square, over the platform or wider when there are many
+void initializePointLights() {
+    const auto LAMP_SPACING = 150.0f;
+    const auto halfSize = std::max(1300.0f, 0.5f * LAMP_SPACING * sqrtf((float) pointLightCount));
+
+    mt19937 random(2048);
+    uniform_real_distribution<float> positionDistribution(-halfSize, halfSize);
+    uniform_real_distribution<float> heightDistribution(15.0f, 40.0f);
+    uniform_real_distribution<float> radiusDistribution(120.0f, 260.0f);
+    uniform_real_distribution<float> tintDistribution(0.5f, 0.8f);
+    vector<PointLight> lights(pointLightCount);
+    for (auto &light: lights) {
+        light.position = vec3(positionDistribution(random), heightDistribution(random), positionDistribution(random));
+        light.radius = radiusDistribution(random);
+        light.color = vec3(1.0f, tintDistribution(random), 0.4f);
+        light.intensity = 1.0f;
+    }
+    clusteredLights.setLights(lights);
+
+    if (pointLightCount > 0) {
+        cout << "Point lights: " << pointLightCount << " in " << ClusteredLights::TILES_X << "x"
+             << ClusteredLights::TILES_Y << "x" << ClusteredLights::SLICES << " clusters" << endl;
+    }
+}
+
+void buildSceneBvh() {
+    vector<AABB> itemBounds;
+    itemBounds.reserve(worldDrawTable.getRangeCount() + trees.getInstanceCount());
+    for (const auto &drawRange: worldDrawTable.getRanges()) {
+        itemBounds.push_back(drawRange.bounds);
+    }
+
+    sceneBvhTreeHandles.resize(trees.getInstanceCount());
+    for (auto i = 0; i < trees.getInstanceCount(); i++) {
+        const auto &instance = trees.getInstanceAt(i);
+        itemBounds.push_back(unitTreeBounds.transformed(instance.scale, instance.rotation, instance.position));
+        sceneBvhTreeHandles[i] = trees.getHandleAt(i);
+    }
+
+    sceneBvh.build(itemBounds);
+    sceneBvhTreeVersion = trees.getInstanceVersion();
+}
+
+// After trees were added, updated or removed - the items' bounds are stale, and so are the shadows of the old casters
+void rebuildSceneBvh() {
+    buildSceneBvh();
+    if (isShadowMappingEnabled) {
+        shadowCascades.setLight(lightPosition, sceneBvh.getBounds());
+    }
+}
+
+// Everything in the scene casts shadows of the point light at lightPosition, like the shading & baked lighting see it
+void initializeShadows() {
+    if (!isShadowMappingEnabled) {
+        return;
+    }
+
+    shadowCascades.setLight(lightPosition, sceneBvh.getBounds());
+    cout << "Shadows: " << ShadowCascades::CASCADE_COUNT << " cascades of " << ShadowCascades::STATIC_SIZE << "x"
+         << ShadowCascades::STATIC_SIZE << " up to " << cameraFarPlane << " from the camera" << endl;
+}
+
+// Visible trees grouped by level of detail and ordered front to back within each, so nearer trees fill the depth
+// buffer first
+void sortVisibleTrees() {
+    RenderQueue::radixSort(treeSortEntries, treeSortScratch);
+
+    visibleTreeHandlesByLod.resize(trees.getLodCount());
+    nearestTreeDistanceBits.resize(trees.getLodCount());
+    for (auto &handles: visibleTreeHandlesByLod) {
+        handles.clear();
+    }
+    for (const auto &entry: treeSortEntries) {
+        auto &handles = visibleTreeHandlesByLod[entry.key >> 32];
+        if (handles.empty()) {
+            nearestTreeDistanceBits[entry.key >> 32] = (uint32_t) entry.key;
+        }
+        handles.push_back(entry.value);
+    }
+    trees.setVisibleInstances(visibleTreeHandlesByLod);
+}
+
+void selectTreeLods(const mat4 &projection, int height) {
+    const auto pixelsPerUnit = LodSelector::pixelsPerUnitAtUnitDistance(projection, (float) height);
+    const auto worldRangeCount = (unsigned) worldDrawTable.getRangeCount();
+
+    treeSortEntries.clear();
+    for (const auto item: visibleSceneItems) {
+        if (item < worldRangeCount) {
+            continue;
+        }
+
+        const auto handle = sceneBvhTreeHandles[item - worldRangeCount];
+        if (handle >= treeLodLevels.size()) {
+            treeLodLevels.resize(handle + 1, 0);
+        }
+
+        const auto &bounds = sceneBvh.getItemBounds(item);
+        const auto projectedSize = LodSelector::projectedSize(bounds, cameraPos, pixelsPerUnit);
+        treeLodLevels[handle] = (GLubyte) TREE_LOD_SELECTOR.select(projectedSize, treeLodLevels[handle]);
+        treeSortEntries.push_back(RenderQueue::SortEntry{
+                (uint64_t) treeLodLevels[handle] << 32 | RenderQueue::getDistanceBits(bounds.distanceTo(cameraPos)),
+                handle
+        });
+    }
+    sortVisibleTrees();
+}
+
+// Drops the frustum-visible items hidden behind the occluders of an earlier frame
+void cullOccludedItems(const mat4 &viewProjection) {
+    occlusionCuller.resetStats();
+    occlusionCuller.update(viewProjection);
+    visibleSceneItems.erase(remove_if(visibleSceneItems.begin(), visibleSceneItems.end(), [](unsigned item) {
+        return !occlusionCuller.isVisible(sceneBvh.getItemBounds(item));
+    }), visibleSceneItems.end());
+}
+
+// Depth of all the world submeshes, read back for the culling of the next frames
+void renderOccluders(const mat4 &viewProjection) {
+    if (!occlusionCuller.beginOccluderPass(viewProjection)) {
+        return;
+    }
+
+    glBindVertexArray(vao);
+    for (const auto &drawRange: worldDrawTable.getRanges()) {
+        worldDepthDraws.add(drawRange.indexOffset, drawRange.indexCount, drawRange.baseVertex);
+    }
+    worldDepthDraws.flush();
+    glBindVertexArray(0);
+    occlusionCuller.endOccluderPass();
+}
+
+// Only the cascades that were re-centered are drawn, the moving tree goes into the overlay every frame
+void renderShadows() {
+    shadowCascades.update(cameraPos, cameraFarPlane, !movingTrees.empty());
+
+    const auto worldRangeCount = (unsigned) worldDrawTable.getRangeCount();
+    const auto &worldRanges = worldDrawTable.getRanges();
+    for (auto cascade = 0; cascade < ShadowCascades::CASCADE_COUNT; cascade++) {
+        if (!shadowCascades.isStaticDirty(cascade)) {
+            continue;
+        }
+
+        shadowCasterItems.clear();
+        sceneBvh.cull(Frustum::fromMatrix(shadowCascades.getLightViewProjection(cascade)), shadowCasterItems);
+        shadowTreeHandles.clear();
+
+        shadowCascades.beginStaticPass(cascade);
+        glBindVertexArray(vao);
+        InstancedMesh::setDefaultInstanceAttributes();
+        for (const auto item: shadowCasterItems) {
+            if (item >= worldRangeCount) {
+                shadowTreeHandles.push_back(sceneBvhTreeHandles[item - worldRangeCount]);
+            } else {
+                worldDepthDraws.add(worldRanges[item].indexOffset, worldRanges[item].indexCount,
+                                    worldRanges[item].baseVertex);
+            }
+        }
+        worldDepthDraws.flush();
+        // At the finest level, a coarser one would poke through the surfaces of the finer levels drawn near the
+        // camera and cover them in acne
+        trees.drawInstances(shadowTreeHandles, 0);
+        glBindVertexArray(0);
+        shadowCascades.endStaticPass(cascade);
+    }
+
+    if (!movingTrees.empty()) {
+        shadowCascades.beginDynamicPass();
+        trees.drawInstances(movingTrees, 0);
+        glBindVertexArray(0);
+        shadowCascades.endDynamicPass();
+    }
+}
+
+void updateMovingTree() {
+    const auto angle = 2.0f * (float) M_PI * lastFrameTimestamp / MOVING_TREE_PERIOD;
+    movingTrees.assign(1, InstancedMesh::makeInstance(
+            vec3(MOVING_TREE_RADIUS * cosf(angle), 0.0f, MOVING_TREE_RADIUS * sinf(angle)), 1.0f, -angle
+    ));
+}
+
+// Always at the finest level, the moving tree isn't culled
+void renderMovingTree() {
+    glUseProgram(shaderManager.getProgram(treeVariant));
+    trees.drawInstances(movingTrees, 0);
+    glBindVertexArray(0);
+}
+
+void cullScene(const mat4 &projection, const mat4 &view, int height) {
+    if (trees.getInstanceVersion() != sceneBvhTreeVersion) {
+        rebuildSceneBvh();
+    }
+
+    cullingView = view;
+    visibleSceneItems.clear();
+    if (isCullingEnabled) {
+        cullingStats = sceneBvh.cull(Frustum::fromMatrix(projection * view), visibleSceneItems);
+    } else {
+        for (auto item = 0; item < sceneBvh.getItemCount(); item++) {
+            visibleSceneItems.push_back(item);
+        }
+    }
+
+    if (isOcclusionCullingEnabled) {
+        cullOccludedItems(projection * view);
+    }
+
+    const auto worldRangeCount = (unsigned) worldDrawTable.getRangeCount();
+    worldDrawTable.setAllVisible(false);
+    treeSortEntries.clear();
+    for (const auto item: visibleSceneItems) {
+        if (item < worldRangeCount) {
+            worldDrawTable.setVisible(item, true);
+        } else {
+            // All at the finest level
+            const auto distance = sceneBvh.getItemBounds(item).distanceTo(cameraPos);
+            treeSortEntries.push_back(RenderQueue::SortEntry{
+                    RenderQueue::getDistanceBits(distance), sceneBvhTreeHandles[item - worldRangeCount]
+            });
+        }
+    }
+
+    if (isLodEnabled) {
+        selectTreeLods(projection, height);
+    } else {
+        sortVisibleTrees();
+    }
+}
 
+void submitDraws() {
+    renderQueue.clear();
+
+    const auto &worldRanges = worldDrawTable.getRanges();
+    for (auto i = 0; i < worldRanges.size(); i++) {
+        if (!worldDrawTable.isVisible(i) || worldRanges[i].indexCount == 0) {
+            continue;
+        }
+
+        const auto variant = worldDrawTable.getVariant(i);
+        const auto distanceBits = RenderQueue::getDistanceBits(worldRanges[i].bounds.distanceTo(cameraPos));
+        renderQueue.submit(
+                RenderQueue::makeKey((GLuint) variant, WORLD_MESH_ID, worldRangeMaterials[i], distanceBits),
+                DrawItem{shaderManager.getProgram(variant), vao, worldRanges[i].indexOffset,
+                         worldRanges[i].indexCount, worldRanges[i].baseVertex, nullptr, 0}
+        );
+    }
+
+    for (auto lod = 0; lod < visibleTreeHandlesByLod.size(); lod++) {
+        if (visibleTreeHandlesByLod[lod].empty()) {
+            continue;
+        }
+        renderQueue.submit(
+                RenderQueue::makeKey((GLuint) treeVariant, TREE_MESH_ID, treeMaterial, nearestTreeDistanceBits[lod]),
+                DrawItem{shaderManager.getProgram(treeVariant), 0, 0, 0, 0, &trees, (GLuint) lod}
+        );
+    }
+
+    renderQueue.sort();
+}
+
+void uploadWorld(const MeshView &worldMesh) {
     // Initialize buffers
     glGenVertexArrays(1, &vao);
     glGenBuffers(1, &vbo);
@@ -1519,103 +1905,594 @@ void initializeScene() {
 
     glBindVertexArray(vao);
 
-    // Sizes
-    auto verticesSize = worldMesh.vertices.size() * (sizeof worldMesh.vertices[0]);
-    auto colorsSize = worldMesh.colors.size() * (sizeof worldMesh.colors[0]);
-    auto shininessesSize = worldMesh.shininesses.size() * (sizeof worldMesh.shininesses[0]);
-    auto normalsSize = worldMesh.normals.size() * (sizeof worldMesh.normals[0]);
-    auto indicesSize = worldMesh.indices.size() * (sizeof worldMesh.indices[0]);
+    worldVertexCount = (GLsizei) worldMesh.vertexCount;
+    worldDrawTable.setRanges(worldMesh.drawRanges);
+    worldRangeMaterials.resize(worldMesh.drawRanges.size());
+    for (auto i = 0; i < worldMesh.drawRanges.size(); i++) {
+        worldDrawTable.setVariant(i, selectShaderVariant(getMaxShininess(worldMesh, worldMesh.drawRanges[i]),
+                                                         isLightBakingEnabled ? BakedLighting::FULL
+                                                                              : BakedLighting::NONE));
+        worldRangeMaterials[i] = getPrimaryMaterial(worldMesh, worldMesh.drawRanges[i]);
+    }
+    auto indicesSize = worldMesh.indexCount * (sizeof worldMesh.indices[0]);
 
-    // Buffers
     glBindBuffer(GL_ARRAY_BUFFER, vbo);
-    glBufferData(GL_ARRAY_BUFFER, verticesSize + colorsSize + shininessesSize + normalsSize, NULL, GL_STATIC_DRAW);
-    glBufferSubData(GL_ARRAY_BUFFER, 0, verticesSize, &worldMesh.vertices[0]);
-    glBufferSubData(GL_ARRAY_BUFFER, verticesSize, colorsSize, &worldMesh.colors[0]);
-    glBufferSubData(GL_ARRAY_BUFFER, verticesSize + colorsSize, shininessesSize, &worldMesh.shininesses[0]);
-    glBufferSubData(GL_ARRAY_BUFFER, verticesSize + colorsSize + shininessesSize, normalsSize, &worldMesh.normals[0]);
+    if (vertexLayout == VertexLayout::INTERLEAVED) {
+        // Buffers
+        auto verticesSize = worldMesh.vertexCount * (sizeof worldMesh.vertices[0]);
+        glBufferData(GL_ARRAY_BUFFER, verticesSize, worldMesh.vertices, GL_STATIC_DRAW);
+
+        // Attributes
+        VertexFormat::enableInterleavedAttributes();
+    } else {
+        // Unpack into separate blocks
+        vector<vec3> vertices(worldVertexCount);
+        vector<GLfloat> materials(worldVertexCount);
+        vector<vec3> normals(worldVertexCount);
+        vector<GLubyte> baked(2 * worldVertexCount);
+        for (auto i = 0; i < worldVertexCount; i++) {
+            vertices[i] = worldMesh.vertices[i].position;
+            materials[i] = worldMesh.vertices[i].material;
+            normals[i] = VertexFormat::unpackNormal(worldMesh.vertices[i].normal);
+            baked[2 * i] = worldMesh.vertices[i].occlusion;
+            baked[2 * i + 1] = worldMesh.vertices[i].light;
+        }
+
+        // Sizes
+        auto verticesSize = vertices.size() * (sizeof vertices[0]);
+        auto materialsSize = materials.size() * (sizeof materials[0]);
+        auto normalsSize = normals.size() * (sizeof normals[0]);
+        auto bakedSize = baked.size() * (sizeof baked[0]);
+
+        // Buffers
+        glBufferData(GL_ARRAY_BUFFER, verticesSize + materialsSize + normalsSize + bakedSize, NULL, GL_STATIC_DRAW);
+        glBufferSubData(GL_ARRAY_BUFFER, 0, verticesSize, &vertices[0]);
+        glBufferSubData(GL_ARRAY_BUFFER, verticesSize, materialsSize, &materials[0]);
+        glBufferSubData(GL_ARRAY_BUFFER, verticesSize + materialsSize, normalsSize, &normals[0]);
+        glBufferSubData(GL_ARRAY_BUFFER, verticesSize + materialsSize + normalsSize, bakedSize, &baked[0]);
+
+        // Attributes
+        glEnableVertexAttribArray(0); // 0 = position
+        glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 0, (GLvoid *) 0);
+        glEnableVertexAttribArray(1); // 1 = baked occlusion & light
+        glVertexAttribPointer(1, 2, GL_UNSIGNED_BYTE, GL_TRUE, 2 * sizeof(GLubyte),
+                              (GLvoid *) (verticesSize + materialsSize + normalsSize));
+        glEnableVertexAttribArray(2); // 2 = material
+        glVertexAttribPointer(2, 1, GL_FLOAT, GL_FALSE, sizeof(GLfloat), (GLvoid *) verticesSize);
+        glEnableVertexAttribArray(3); // 3 = normals
+        glVertexAttribPointer(3, 3, GL_FLOAT, GL_FALSE, 3 * sizeof(GLfloat), (GLvoid *) (verticesSize + materialsSize));
+    }
     glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, ebo);
-    glBufferData(GL_ELEMENT_ARRAY_BUFFER, indicesSize, &worldMesh.indices[0], GL_STATIC_DRAW);
-
-    // Attributes
-    glEnableVertexAttribArray(0); // 0 = position
-    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 0, (GLvoid *) 0);
-    glEnableVertexAttribArray(1); // 1 = color
-    glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, 3 * sizeof(GLfloat), (GLvoid *) verticesSize);
-    glEnableVertexAttribArray(2); // 2 = shininesses
-    glVertexAttribPointer(2, 1, GL_FLOAT, GL_FALSE, sizeof(GLfloat), (GLvoid *) (verticesSize + colorsSize));
-    glEnableVertexAttribArray(3); // 3 = normals
-    glVertexAttribPointer(3, 3, GL_FLOAT, GL_FALSE, 3 * sizeof(GLfloat), (GLvoid *) (verticesSize + colorsSize + shininessesSize));
-
-    glEnableVertexAttribArray(0);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, indicesSize, worldMesh.indices, GL_STATIC_DRAW);
+
+    cout << "Vertex layout: " << VertexFormat::layoutName(vertexLayout) << ", "
+         << VertexFormat::bytesPerVertex(vertexLayout) << " bytes/vertex, "
+         << worldVertexCount << " vertices, "
+         << worldVertexCount * VertexFormat::bytesPerVertex(vertexLayout) << " bytes, "
+         << worldDrawTable.getRangeCount() << " submeshes" << endl;
+}
+
+// Everything the generated meshes depend on
+uint64_t getSceneContentHash() {
+    ContentHash hash;
+    hash.addValue(SCENE_GENERATOR_VERSION);
+    hash.addValue(sizeof(PackedVertex));
+    hash.addValue(SPHERE_PARALLELS);
+    hash.addValue(SPHERE_MERIDIANS);
+    hash.addValue(CYLINDER_PARALLELS);
+    hash.addValue(CYLINDER_MERIDIANS);
+    for (const auto value: {TREE_LEAVES_RADIUS, TREE_TRUNK_HEIGHT, TREE_TRUNK_RADIUS}) {
+        hash.addValue(value);
+    }
+    // The cached material table is used as is
+    for (const auto &material: {Constants::MATERIAL_GRASS, Constants::MATERIAL_ROAD, Constants::MATERIAL_WALLS,
+                                Constants::MATERIAL_DOOR, Constants::MATERIAL_FRAMES, Constants::MATERIAL_WINDOWS,
+                                Constants::MATERIAL_ROOF, Constants::MATERIAL_CHIMNEY,
+                                Constants::MATERIAL_CHIMNEY_INNER, Constants::MATERIAL_TREE_LEAVES,
+                                Constants::MATERIAL_TREE_TRUNK}) {
+        hash.addValue(material);
+    }
+    hash.addValue(MATTE_SHININESS);
+    hash.addValue(PLATFORM_HOUSE_VERTICES);
+    for (const auto *material: PLATFORM_HOUSE_MATERIALS) {
+        hash.addValue(*material);
+    }
+    hash.addValue(PLATFORM_HOUSE_INDICES);
+    hash.addValue(PLATFORM_INDEX_COUNT);
+    hash.addValue(isWeldingEnabled);
+    hash.addValue(isIndexOptimizationEnabled);
+    hash.addValue(MeshOptimizer::WELD_EPSILON);
+    hash.addValue(MeshOptimizer::CACHE_SIZE);
+    hash.addValue(isLightBakingEnabled);
+    if (isLightBakingEnabled) {
+        hash.addValue(BAKE_MAX_EDGE_LENGTH);
+        hash.addValue(lightPosition);
+        hash.addValue(PLATFORM_TREE_POSITIONS);
+        hash.addValue(LightBaker::OCCLUSION_RAY_COUNT);
+        hash.addValue(LightBaker::OCCLUSION_DISTANCE);
+        hash.addValue(LightBaker::RAY_OFFSET);
+    }
+    return hash.get();
+}
+
+// In a fixed order before the generation jobs start - the ids go into the vertices and the scene cache, so they
+// mustn't depend on which thread gets to a material first
+void registerSceneMaterials() {
+    for (const auto *material: {&Constants::MATERIAL_GRASS, &Constants::MATERIAL_ROAD, &Constants::MATERIAL_WALLS,
+                                &Constants::MATERIAL_DOOR, &Constants::MATERIAL_FRAMES, &Constants::MATERIAL_WINDOWS,
+                                &Constants::MATERIAL_ROOF, &Constants::MATERIAL_CHIMNEY,
+                                &Constants::MATERIAL_CHIMNEY_INNER, &Constants::MATERIAL_TREE_LEAVES,
+                                &Constants::MATERIAL_TREE_TRUNK}) {
+        materialTable.getId(*material);
+    }
+}
+
+void initializeScene() {
+    // The forest isn't cached - it depends on --trees and is cheap compared to the upload of its instances
+    const auto generationStart = chrono::steady_clock::now();
+    JobCounter generationJobs;
+    vector<MeshInstance> forestInstances;
+    generateForest(forestInstances, generationJobs);
+
+    // Cached meshes - uploaded straight from the mapped file
+    const auto contentHash = getSceneContentHash();
+    SceneCache sceneCache;
+    if (isSceneCacheEnabled && sceneCache.open(sceneCachePath, contentHash) && sceneCache.getMeshCount() == 2) {
+        materialTable.setAll(sceneCache.getMaterials());
+        threadPool.wait(generationJobs);
+
+        uploadWorld(sceneCache.getMesh(0));
+        initializeTrees(sceneCache.getMesh(1), forestInstances);
+        cout << "Scene cache: loaded " << sceneCachePath << " (" << sceneCache.getSize() / 1024 << " KB) in "
+             << chrono::duration<float, milli>(chrono::steady_clock::now() - generationStart).count() << " ms"
+             << endl;
+        sceneCache.close();
+    } else {
+        // Generation - the jobs only write into space reserved up front, the platform & house is generated on this
+        // thread in the meantime (its tables come from the scene arena, which isn't thread safe)
+        registerSceneMaterials();
+        MeshBuilder treeBuilder(getSceneResource());
+        generateTreeLods(treeBuilder, generationJobs);
+
+        MeshBuilder builder(getSceneResource());
+        appendPlatformAndHouseMesh(builder);
+        threadPool.wait(generationJobs);
+        cout << "Scene generation: "
+             << chrono::duration<float, milli>(chrono::steady_clock::now() - generationStart).count() << " ms on "
+             << threadPool.getThreadCount() << " threads" << endl;
+
+        // Merge
+        reportMeshBuilder("world", builder.getStats());
+        reportMeshBuilder("trees", treeBuilder.getStats());
+        auto worldMesh = builder.build();
+        auto unitTreeMesh = treeBuilder.build();
+        if (isLightBakingEnabled) {
+            reportSubdivision("world", MeshOptimizer::subdivide(worldMesh.vertices, worldMesh.indices,
+                                                                worldMesh.drawRanges, BAKE_MAX_EDGE_LENGTH));
+        }
+        prepareMesh("world", worldMesh);
+        prepareMesh("trees", unitTreeMesh);
+        if (isLightBakingEnabled) {
+            bakeLighting(worldMesh, unitTreeMesh);
+        }
+
+        if (isSceneCacheEnabled &&
+            SceneCache::write(sceneCachePath, contentHash, {worldMesh.view(), unitTreeMesh.view()},
+                              materialTable.getAll())) {
+            cout << "Scene cache: written to " << sceneCachePath << endl;
+        }
+
+        // Upload
+        uploadWorld(worldMesh.view());
+        initializeTrees(unitTreeMesh.view(), forestInstances);
+    }
+
+    // Materials
+    bindShaderPrograms();
+    reportShaders();
+
+    buildSceneBvh();
+    cout << "Scene BVH: " << sceneBvh.getItemCount() << " items, " << sceneBvh.getNodeCount() << " nodes" << endl;
+    initializePointLights();
+    initializeShadows();
+}
+
+
+void initializeProfiler() {
+    profileInput = profiler.addStage("input");
+    profileUniforms = profiler.addStage("uniforms");
+    profileCulling = profiler.addStage("culling");
+    profileDraw = profiler.addStage("draw");
+    profilePresent = profiler.addStage("present");
+    profiler.initialize();
+
+    if (profileCsvPath) {
+        profiler.openCsv(profileCsvPath);
+    }
+}
+
+// Without fog (or with --no-fog-culling) the far plane stays where it is
+void initializeFogCulling() {
+    if (!isFogEnabled) {
+        isFogCullingEnabled = false;
+    }
+    if (!isFogCullingEnabled) {
+        return;
+    }
+
+    cameraFarPlane = std::min(CAMERA_FAR_PLANE, Constants::FOG.getFullyFoggedDepth());
+    cout << "Fog: fully fogged beyond " << Constants::FOG.getFullyFoggedDepth() << ", far plane at "
+         << cameraFarPlane << " instead of " << CAMERA_FAR_PLANE << endl;
+}
+
+const mat4 &getCameraProjection(int width, int height) {
+    if (width != cameraProjectionWidth || height != cameraProjectionHeight) {
+        cameraProjection = glm::perspectiveLH(
+                glm::radians(CAMERA_FOV),
+                (float) width / (float) glm::max(height, 1),
+                CAMERA_NEAR_PLANE, cameraFarPlane
+        );
+        cameraProjectionWidth = width;
+        cameraProjectionHeight = height;
+    }
+
+    return cameraProjection;
+}
+
+void render(int width, int height) {
+    const auto &projection = getCameraProjection(width, height);
+    const auto view = glm::lookAtLH(cameraPos, cameraPos + cameraDirection, CAMERA_UP);
+    {
+        FrameProfiler::Scope uniformsScope(profiler, profileUniforms);
+
+        // Camera, lighting & fog - the light and camera positions are transformed here once instead of per vertex
+        FrameConstantsData frameData;
+        frameData.viewProjection = projection * view;
+        frameData.cameraPosition = vec4(cameraPos, 1.0f);
+        frameData.lightPosition = vec4(vec3(frameData.viewProjection * vec4(lightPosition, 1.0f)), 1.0f);
+        frameData.viewPosition = vec4(vec3(frameData.viewProjection * vec4(cameraPos, 1.0f)), 1.0f);
+        frameData.lightColor = vec4(LIGHT_COLOR, 1.0f);
+        frameData.skyColor = vec4(Constants::COLOR_SKY, 1.0f);
+        frameData.fog = Constants::FOG.getShaderParameters();
+        frameConstants.update(frameData);
+        materialTable.upload();
+    }
+
+    // Culling
+    {
+        FrameProfiler::Scope cullingScope(profiler, profileCulling);
+        cullScene(projection, view, height);
+        if (clusteredLights.getLightCount() > 0) {
+            clusteredLights.update(projection, view, width, height, CAMERA_NEAR_PLANE, cameraFarPlane);
+        }
+    }
+
+    FrameProfiler::Scope drawScope(profiler, profileDraw);
+    profiler.beginGpuTimer();
+
+    if (isMovingTreeEnabled) {
+        updateMovingTree();
+    }
+
+    if (isShadowMappingEnabled) {
+        renderShadows();
+    }
+    if (isOcclusionCullingEnabled) {
+        renderOccluders(projection * view);
+    }
+    submitDraws();
+    renderQueue.execute();
+    if (isMovingTreeEnabled) {
+        renderMovingTree();
+    }
+
+    profiler.endGpuTimer();
 }
 
-void render() {
-    glUseProgram(shaderProgram);
+void cleanUp() {
+    shaderManager.cleanUp();
+    threadPool.cleanUp();
+    trees.cleanUp();
+    profiler.cleanUp();
+    frameConstants.cleanUp();
+    materialTable.cleanUp();
+    clusteredLights.cleanUp();
+    shadowCascades.cleanUp();
+    if (isOcclusionCullingEnabled) {
+        occlusionCuller.cleanUp();
+    }
 
-    // Projection
-    glm::mat4 projection = glm::perspectiveLH(
+    glDisableVertexAttribArray(2);
+    glDisableVertexAttribArray(0);
+}
+
+void parseArguments(int argc, char **argv) {
+    for (auto i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--vertex-layout=planar") == 0) {
+            vertexLayout = VertexLayout::PLANAR;
+        } else if (strcmp(argv[i], "--vertex-layout=interleaved") == 0) {
+            vertexLayout = VertexLayout::INTERLEAVED;
+        } else if (strcmp(argv[i], "--headless") == 0) {
+            isHeadless = true;
+        } else if (strncmp(argv[i], "--frames=", strlen("--frames=")) == 0) {
+            headlessFrameCount = std::max(1, atoi(argv[i] + strlen("--frames=")));
+        } else if (strncmp(argv[i], "--output=", strlen("--output=")) == 0) {
+            headlessOutputPath = argv[i] + strlen("--output=");
+        } else if (strncmp(argv[i], "--profile-csv=", strlen("--profile-csv=")) == 0) {
+            profileCsvPath = argv[i] + strlen("--profile-csv=");
+        } else if (strcmp(argv[i], "--no-culling") == 0) {
+            isCullingEnabled = false;
+        } else if (strcmp(argv[i], "--no-occlusion") == 0) {
+            isOcclusionCullingEnabled = false;
+        } else if (strcmp(argv[i], "--no-index-optimization") == 0) {
+            isIndexOptimizationEnabled = false;
+        } else if (strcmp(argv[i], "--no-welding") == 0) {
+            isWeldingEnabled = false;
+        } else if (strcmp(argv[i], "--bake-lighting") == 0) {
+            isLightBakingEnabled = true;
+        } else if (strncmp(argv[i], "--threads=", strlen("--threads=")) == 0) {
+            threadCount = (unsigned) std::max(0, atoi(argv[i] + strlen("--threads=")));
+        } else if (strcmp(argv[i], "--benchmark-shapes") == 0) {
+            isShapeBenchmark = true;
+        } else if (strncmp(argv[i], "--scene-cache=", strlen("--scene-cache=")) == 0) {
+            sceneCachePath = argv[i] + strlen("--scene-cache=");
+        } else if (strcmp(argv[i], "--no-scene-cache") == 0) {
+            isSceneCacheEnabled = false;
+        } else if (strncmp(argv[i], "--shader-cache=", strlen("--shader-cache=")) == 0) {
+            programCacheDirectory = argv[i] + strlen("--shader-cache=");
+        } else if (strcmp(argv[i], "--no-shader-cache") == 0) {
+            isProgramCacheEnabled = false;
+        } else if (strncmp(argv[i], "--shader-dir=", strlen("--shader-dir=")) == 0) {
+            shaderDirectory = argv[i] + strlen("--shader-dir=");
+        } else if (strcmp(argv[i], "--no-hot-reload") == 0) {
+            isShaderHotReloadEnabled = false;
+        } else if (strcmp(argv[i], "--no-permutations") == 0) {
+            isPermutationEnabled = false;
+        } else if (strcmp(argv[i], "--no-fog") == 0) {
+            isFogEnabled = false;
+        } else if (strcmp(argv[i], "--no-fog-culling") == 0) {
+            isFogCullingEnabled = false;
+        } else if (strcmp(argv[i], "--no-shadows") == 0) {
+            isShadowMappingEnabled = false;
+        } else if (strcmp(argv[i], "--moving-tree") == 0) {
+            isMovingTreeEnabled = true;
+        } else if (strcmp(argv[i], "--lighting-model=phong") == 0) {
+            lightingModel = LightingModel::PHONG;
+        } else if (strcmp(argv[i], "--lighting-model=blinn-phong") == 0) {
+            lightingModel = LightingModel::BLINN_PHONG;
+        } else if (strcmp(argv[i], "--no-arena") == 0) {
+            isSceneArenaEnabled = false;
+        } else if (strcmp(argv[i], "--no-lod") == 0) {
+            isLodEnabled = false;
+        } else if (strncmp(argv[i], "--trees=", strlen("--trees=")) == 0) {
+            forestTreeCount = std::max(0, atoi(argv[i] + strlen("--trees=")));
+        } else if (strncmp(argv[i], "--lights=", strlen("--lights=")) == 0) {
+            pointLightCount = std::max(0, atoi(argv[i] + strlen("--lights=")));
+        } else {
+            cout << "Unknown argument: " << argv[i] << endl;
+        }
+    }
+}
+
+void reportOcclusion(const char *label) {
+    const auto &occlusionStats = occlusionCuller.getStats();
+    cout << label << ": " << occlusionStats.occludedCount << " of " << occlusionStats.testedCount << " occluded";
+    if (occlusionStats.fallbackCount > 0) {
+        cout << ", " << occlusionStats.fallbackCount << " kept without a finished depth pass";
+    }
+    cout << endl;
+}
+
+// Culls again with the untightened far plane, only when reporting
+void reportFogCulling(const char *label) {
+    const auto projection = glm::perspectiveLH(
             glm::radians(CAMERA_FOV),
-            (float) Constants::WIDTH / (float) Constants::HEIGHT,
+            (float) cameraProjectionWidth / (float) glm::max(cameraProjectionHeight, 1),
             CAMERA_NEAR_PLANE, CAMERA_FAR_PLANE
     );
-    glUniformMatrix4fv(projLocation, 1, GL_FALSE, &projection[0][0]);
+    unfoggedSceneItems.clear();
+    const auto unfoggedStats = sceneBvh.cull(Frustum::fromMatrix(projection * cullingView), unfoggedSceneItems);
+    cout << label << ": " << unfoggedStats.visibleCount - cullingStats.visibleCount << " of "
+         << unfoggedStats.visibleCount << " items in view are fully fogged" << endl;
+}
 
-    // View
-    glm::mat4 view = glm::lookAtLH(cameraPos, cameraPos + cameraDirection, CAMERA_UP);
-    glUniformMatrix4fv(viewLocation, 1, GL_FALSE, &view[0][0]);
+void reportPointLights(const char *label) {
+    const auto &lightStats = clusteredLights.getStats();
+    cout << label << ": " << lightStats.visibleLightCount << " of " << clusteredLights.getLightCount()
+         << " in view, " << lightStats.occupiedClusterCount << " of " << ClusteredLights::CLUSTER_COUNT
+         << " clusters lit, " << lightStats.indexCount << " list entries (at most "
+         << lightStats.maxClusterLightCount << " per cluster), assigned in " << lightStats.assignMilliseconds
+         << " ms" << endl;
+}
 
-    // Lighting
-    glUniform3f(viewPositionLocation, cameraPos.x, cameraPos.y, cameraPos.z);
-    glUniform3f(lightPositionLocation, lightPosition.x, lightPosition.y, lightPosition.z);
-    glUniform3f(lightColorLocation, LIGHT_COLOR.x, LIGHT_COLOR.y, LIGHT_COLOR.z);
-    glUniform3f(skyColorLocation, Constants::COLOR_SKY.r, Constants::COLOR_SKY.g, Constants::COLOR_SKY.b);
+void reportShadows(const char *label) {
+    const auto &shadowStats = shadowCascades.getStats();
+    cout << label << ": " << shadowStats.staticPassCount << " static cascade passes, "
+         << shadowStats.dynamicPassCount << " dynamic overlay passes" << endl;
+}
 
-    glBindVertexArray(vao);
-    glDrawElements(GL_TRIANGLES, 6000, GL_UNSIGNED_INT, 0);
-    glBindVertexArray(0);
+void reportFrameTime() {
+    frameTimeAccumulator += deltaTime;
+    frameTimeSamples++;
+    if (frameTimeAccumulator < FRAME_TIME_REPORT_INTERVAL) {
+        return;
+    }
+
+    cout << "Frame time (" << VertexFormat::layoutName(vertexLayout) << ", "
+         << VertexFormat::bytesPerVertex(vertexLayout) << " bytes/vertex): "
+         << 1000.0f * frameTimeAccumulator / (float) frameTimeSamples << " ms" << endl;
+    profiler.printSummary(cout);
+    if (isCullingEnabled) {
+        cout << "Culling: " << cullingStats.visibleCount << " visible, "
+             << cullingStats.culledCount << " culled, "
+             << cullingStats.nodesVisited << " BVH nodes visited" << endl;
+    }
+    if (isOcclusionCullingEnabled) {
+        reportOcclusion("Occlusion");
+    }
+    if (isCullingEnabled && isFogCullingEnabled) {
+        reportFogCulling("Fog culling");
+    }
+    if (clusteredLights.getLightCount() > 0) {
+        reportPointLights("Point lights");
+    }
+    if (isShadowMappingEnabled) {
+        reportShadows("Shadows");
+    }
+    const auto &queueStats = renderQueue.getStats();
+    cout << "Render queue: " << queueStats.itemCount << " items in " << queueStats.drawCount << " draws, "
+         << queueStats.programChanges << " program changes, " << queueStats.vaoChanges << " VAO changes" << endl;
+    if (isLodEnabled) {
+        cout << "Trees drawn per level of detail:";
+        for (const auto &handles: visibleTreeHandlesByLod) {
+            cout << " " << handles.size();
+        }
+        cout << " (" << trees.getDrawnTriangleCount() << " triangles)" << endl;
+    }
+    frameTimeAccumulator = 0.0f;
+    frameTimeSamples = 0;
 }
 
-void cleanUp() {
-    glDeleteProgram(shaderProgram);
+void reportHeadlessRun(vector<float> frameTimes) {
+    if (frameTimes.empty()) {
+        return;
+    }
 
-    glDisableVertexAttribArray(1);
-    glDisableVertexAttribArray(0);
+    sort(frameTimes.begin(), frameTimes.end());
+    auto totalTime = 0.0f;
+    for (const auto frameTime: frameTimes) {
+        totalTime += frameTime;
+    }
+
+    cout << "Headless run: " << frameTimes.size() << " frames in " << totalTime << " s, "
+         << "avg " << 1000.0f * totalTime / (float) frameTimes.size() << " ms, "
+         << "min " << 1000.0f * frameTimes.front() << " ms, "
+         << "max " << 1000.0f * frameTimes.back() << " ms, "
+         << (float) frameTimes.size() / totalTime << " fps" << endl;
 }
 
-int main() {
-    GLFWwindow *window = initializeWindow();
+int main(int argc, char **argv) {
+    parseArguments(argc, argv);
+    initializeFogCulling();
+    if (isShapeBenchmark) {
+        benchmarkShapes();
+        return 0;
+    }
+
+    GLFWwindow *window = nullptr;
+    if (isHeadless) {
+        initializeHeadless();
+    } else {
+        window = initializeWindow();
+    }
     initializeShaders();
+    threadPool.initialize(threadCount);
+
+    const auto sceneAllocations = AllocationTracker::snapshot();
     initializeScene();
+    AllocationTracker::report(cout, "Scene construction", sceneAllocations);
+    if (isSceneArenaEnabled) {
+        cout << "Scene arena: " << sceneArena.getAllocationCount() << " allocations, "
+             << sceneArena.getBytesAllocated() / 1024 << " KB in " << sceneArena.getBlockCount() << " blocks" << endl;
+    }
+    sceneArena.release();
+
+    initializeProfiler();
 
-    while (!glfwWindowShouldClose(window)) {
-        int width, height;
-        glfwGetFramebufferSize(window, &width, &height);
+    const auto startTimestamp = chrono::steady_clock::now();
+    const auto initialCameraYaw = cameraYaw;
+    vector<float> headlessFrameTimes;
+    headlessFrameTimes.reserve(headlessFrameCount);
+
+    for (auto frame = 0; isHeadless ? frame < headlessFrameCount : !glfwWindowShouldClose(window); frame++) {
+        int width = Constants::WIDTH, height = Constants::HEIGHT;
+
+        profiler.beginFrame();
 
         // Input
-        processInput(window);
+        {
+            FrameProfiler::Scope inputScope(profiler, profileInput);
+            if (isHeadless) {
+                cameraYaw = initialCameraYaw + HEADLESS_CAMERA_SWEEP * (float) frame / (float) headlessFrameCount;
+                updateCameraDirection();
+            } else {
+                glfwGetFramebufferSize(window, &width, &height);
+                processInput(window);
+            }
+        }
 
         // Timing
-        float currentFrame = (float)(glfwGetTime());
+        float currentFrame = chrono::duration<float>(chrono::steady_clock::now() - startTimestamp).count();
         deltaTime = currentFrame - lastFrameTimestamp;
         lastFrameTimestamp = currentFrame;
+        if (isHeadless && frame > 0) {
+            headlessFrameTimes.push_back(deltaTime);
+        }
+        reportFrameTime();
+
+        // Swaps in edited shaders once they're compiled
+        if (shaderManager.update()) {
+            bindShaderPrograms();
+        }
 
         // Render
+        if (isHeadless) {
+            headlessContext.bindFramebuffer();
+        }
         glViewport(0, 0, width, height);
         glClearColor(Constants::COLOR_SKY.r, Constants::COLOR_SKY.g, Constants::COLOR_SKY.b, 1.0f);
         glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
         glEnable(GL_DEPTH_TEST);
 
-        render();
+        render(width, height);
+
+        {
+            FrameProfiler::Scope presentScope(profiler, profilePresent);
+            if (isHeadless) {
+                // Nothing is presented, wait for the GPU so the frame times are real
+                glFinish();
+            } else {
+                glFlush();
+                glfwSwapBuffers(window);
+                glfwPollEvents();
+            }
+        }
+        profiler.endFrame();
+    }
 
-        glFlush();
-        glfwSwapBuffers(window);
-        glfwPollEvents();
+    if (isHeadless) {
+        reportHeadlessRun(headlessFrameTimes);
+        profiler.printSummary(cout);
+        cout << "Frame constants uploaded in " << frameConstants.getUploadCount() << " of "
+             << headlessFrameCount << " frames" << endl;
+        const auto &queueStats = renderQueue.getStats();
+        cout << "Render queue (last frame): " << queueStats.itemCount << " items in " << queueStats.drawCount
+             << " draws, " << queueStats.programChanges << " program changes" << endl;
+        if (isOcclusionCullingEnabled) {
+            reportOcclusion("Occlusion (last frame)");
+        }
+        if (isCullingEnabled && isFogCullingEnabled) {
+            reportFogCulling("Fog culling (last frame)");
+        }
+        if (clusteredLights.getLightCount() > 0) {
+            reportPointLights("Point lights (last frame)");
+        }
+        if (isShadowMappingEnabled) {
+            reportShadows("Shadows");
+        }
+        if (headlessOutputPath) {
+            headlessContext.saveFramebuffer(headlessOutputPath);
+        }
     }
 
     cleanUp();
 
-    glfwDestroyWindow(window);
-    glfwTerminate();
+    if (isHeadless) {
+        headlessContext.destroy();
+    } else {
+        glfwDestroyWindow(window);
+        glfwTerminate();
+    }
 
     return 0;
-}
\ No newline at end of file
+}
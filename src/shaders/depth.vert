@@ -0,0 +1,18 @@
+#version 330 core
+
+// Occluder depth pre-pass - positions only
+layout (location = 0) in vec3 in_Position;
+
+layout (std140) uniform FrameConstants {
+    mat4 viewProjection;
+    vec4 cameraPosition;
+    vec4 lightPosition;
+    vec4 viewPosition;
+    vec4 lightColor;
+    vec4 skyColor;
+    vec4 fog;
+};
+
+void main() {
+    gl_Position = viewProjection * vec4(in_Position, 1.0);
+}
@@ -1,42 +1,203 @@
 #version 330 core
 
+// Permutation defines, injected after #version - the defaults are the full shader
+#ifndef FOG
+#define FOG 1
+#endif
+#ifndef SPECULAR
+#define SPECULAR 1
+#endif
+#ifndef LIGHTING_MODEL
+#define LIGHTING_MODEL 0 // 0 = Phong, 1 = Blinn-Phong
+#endif
+#ifndef LIGHT_COUNT
+#define LIGHT_COUNT 1 // 0 = ambient only
+#endif
+#ifndef POINT_LIGHTS
+#define POINT_LIGHTS 1 // Clustered, see ClusteredLights
+#endif
+#ifndef BAKED_LIGHTING
+#define BAKED_LIGHTING 0 // 0 = none, 1 = ambient occlusion, 2 = occlusion & diffuse light, see LightBaker
+#endif
+#ifndef SHADOWS
+#define SHADOWS 1 // Of the LIGHT_COUNT light, see ShadowCascades
+#endif
+
 in vec4 ex_Color;
 in vec3 ex_FragPos;
 in vec3 ex_Normal;
 in vec3 ex_LightPosition;
 in vec3 ex_ViewPosition;
+#if SPECULAR
 in float ex_Shininess;
-in float ex_Visibility;
+#endif
+#if POINT_LIGHTS || SHADOWS
+in vec3 ex_WorldPosition;
+in vec3 ex_WorldNormal;
+#endif
+#if BAKED_LIGHTING > 0
+in vec2 ex_Baked;
+#endif
+
+layout (std140) uniform FrameConstants {
+    mat4 viewProjection;
+    vec4 cameraPosition;
+    vec4 lightPosition;
+    vec4 viewPosition;
+    vec4 lightColor;
+    vec4 skyColor;
+    vec4 fog;
+};
+
+#if POINT_LIGHTS
+// 2 texels per light - position & radius, color & intensity
+uniform samplerBuffer pointLights;
+// Per cluster - first index into lightIndices & light count
+uniform usamplerBuffer clusterLights;
+uniform usamplerBuffer lightIndices;
+
+layout (std140) uniform Clusters {
+    vec4 clusterScale; // x, y = tiles per pixel, z, w = slice = log(depth) * z + w
+    ivec4 clusterCounts; // x, y = tiles, z = slices
+    vec4 clusterDepths; // x = depth covered by the first slice
+};
+#endif
+
+#if SHADOWS
+const int SHADOW_CASCADES = 3;
 
-uniform vec3 lightColor;
-uniform vec3 skyColor;
+uniform sampler2DArrayShadow staticShadowMaps; // A layer per cascade
+uniform sampler2DShadow dynamicShadowMap; // Over the first cascade
+
+layout (std140) uniform Shadows {
+    mat4 lightViewProjections[SHADOW_CASCADES];
+    vec4 cascadeDistances; // Of the cascades from the camera, 0 while shadows are off
+    vec4 cascadeNormalOffsets;
+    vec4 shadowParameters; // x = whether the dynamic map is drawn
+};
+#endif
 
 out vec4 out_Color;
 
 const float AMBIENT_STRENGTH = 0.4f;
 const float SPECULAR_STRENGTH = 0.2f;
 
+#if POINT_LIGHTS
+// Only the lights of the fragment's cluster, shaded in world space
+vec3 getPointLightTerm(float viewDepth) {
+    int slice = viewDepth < clusterDepths.x ? 0 :
+            clamp(int(log(viewDepth) * clusterScale.z + clusterScale.w), 1, clusterCounts.z - 1);
+    ivec2 tile = clamp(ivec2(gl_FragCoord.xy * clusterScale.xy), ivec2(0), clusterCounts.xy - 1);
+    uvec2 cluster = texelFetch(clusterLights, (slice * clusterCounts.y + tile.y) * clusterCounts.x + tile.x).xy;
+
+    vec3 normal = normalize(ex_WorldNormal);
+#if SPECULAR
+    vec3 viewDirection = normalize(cameraPosition.xyz - ex_WorldPosition);
+#endif
+    vec3 term = vec3(0.0f);
+    for (uint i = cluster.x; i < cluster.x + cluster.y; i++) {
+        int light = int(texelFetch(lightIndices, int(i)).x);
+        vec4 positionRadius = texelFetch(pointLights, light * 2);
+        vec4 colorIntensity = texelFetch(pointLights, light * 2 + 1);
+
+        vec3 toLight = positionRadius.xyz - ex_WorldPosition;
+        float distance = length(toLight);
+        // Smooth falloff, 0 from the radius on
+        float falloff = clamp(1.0f - (distance * distance) / (positionRadius.w * positionRadius.w), 0.0f, 1.0f);
+        vec3 radiance = colorIntensity.rgb * colorIntensity.a * falloff * falloff;
+        vec3 lightDirection = toLight / max(distance, 0.0001f);
+        term += max(dot(normal, lightDirection), 0.0) * radiance;
+#if SPECULAR
+#if LIGHTING_MODEL == 1
+        float specularPercentage = pow(max(dot(normal, normalize(lightDirection + viewDirection)), 0.0),
+                                       4.0f * ex_Shininess);
+#else
+        float specularPercentage = pow(max(dot(viewDirection, reflect(-lightDirection, normal)), 0.0), ex_Shininess);
+#endif
+        term += SPECULAR_STRENGTH * specularPercentage * radiance;
+#endif
+    }
+    return term;
+}
+#endif
+
+#if SHADOWS
+// 0 in shadow, 1 lit - the cascade is picked by the distance to the camera
+float getShadow() {
+    float distance = length(ex_WorldPosition - cameraPosition.xyz);
+    if (distance >= cascadeDistances.z) {
+        return 1.0f;
+    }
+    int cascade = distance < cascadeDistances.x ? 0 : distance < cascadeDistances.y ? 1 : 2;
+    vec3 position = ex_WorldPosition + normalize(ex_WorldNormal) * cascadeNormalOffsets[cascade];
+    vec4 lightClipPosition = lightViewProjections[cascade] * vec4(position, 1.0f);
+    if (lightClipPosition.w <= 0.0f) {
+        return 1.0f; // Behind the light
+    }
+    vec3 coordinates = lightClipPosition.xyz / lightClipPosition.w * 0.5f + 0.5f;
+    // Receivers nearer than the casters are lit, the ones past them compare against whatever was drawn
+    coordinates.z = clamp(coordinates.z, 0.0f, 1.0f);
+    float shadow = texture(staticShadowMaps, vec4(coordinates.xy, float(cascade), coordinates.z));
+    if (cascade == 0 && shadowParameters.x > 0.0f) {
+        shadow = min(shadow, texture(dynamicShadowMap, coordinates));
+    }
+    return shadow;
+}
+#endif
+
 void main() {
     vec3 objectColor = vec3(ex_Color);
+    // Exact per fragment - gl_FragCoord.w is 1 / clip w, and the perspective projection keeps the view depth in w
+    float viewDepth = 1.0f / gl_FragCoord.w;
 
     // Ambient lighting
-    vec3 ambientTerm = AMBIENT_STRENGTH * skyColor;
+    vec3 ambientTerm = AMBIENT_STRENGTH * skyColor.rgb;
+#if BAKED_LIGHTING > 0
+    ambientTerm *= ex_Baked.x;
+#endif
 
+    vec3 lightTerm = ambientTerm;
+#if LIGHT_COUNT > 0 && BAKED_LIGHTING == 2
+    // Diffuse lighting & shadows, traced at build time
+    lightTerm += ex_Baked.y * lightColor.rgb;
+#elif LIGHT_COUNT > 0
     // Diffuse lighting
     vec3 normal = normalize(ex_Normal);
     vec3 lightDirection = normalize(ex_LightPosition - ex_FragPos);
     float diffusionPercentage = max(dot(normal, lightDirection), 0.0);
-    vec3 diffuseTerm = diffusionPercentage * lightColor;
+#if SHADOWS
+    vec3 shadowedLightColor = getShadow() * lightColor.rgb;
+#else
+    vec3 shadowedLightColor = lightColor.rgb;
+#endif
+    lightTerm += diffusionPercentage * shadowedLightColor;
 
+#if SPECULAR
     // Specular lighting
     vec3 viewDirection = normalize(ex_ViewPosition - ex_FragPos);
+#if LIGHTING_MODEL == 1
+    // The half vector highlight is wider, a higher exponent roughly matches Phong
+    vec3 halfDirection = normalize(lightDirection + viewDirection);
+    float specularPercentage = pow(max(dot(normal, halfDirection), 0.0), 4.0f * ex_Shininess);
+#else
     vec3 reflectDirection = reflect(-lightDirection, normal);
     float specularPercentage = pow(max(dot(viewDirection, reflectDirection), 0.0), ex_Shininess);
-    vec3 specularTerm = SPECULAR_STRENGTH * specularPercentage * lightColor;
+#endif
+    lightTerm += SPECULAR_STRENGTH * specularPercentage * shadowedLightColor;
+#endif
+#endif
+#if POINT_LIGHTS
+    lightTerm += getPointLightTerm(viewDepth);
+#endif
 
     // Final color
-    vec3 result = (ambientTerm + diffuseTerm + specularTerm) * objectColor;
+    vec3 result = lightTerm * objectColor;
     out_Color = vec4(result, 1.0f);
 
-    out_Color = mix(vec4(skyColor, 1.0f), out_Color, ex_Visibility);
+#if FOG
+    // Same as Fog::getVisibility, per fragment so whatever is past the fully fogged depth (and clipped by the far
+    // plane there) really is the sky color
+    float visibility = clamp(exp(-pow((viewDepth * fog.x), fog.y)), 0.0f, 1.0f);
+    out_Color = mix(vec4(skyColor.rgb, 1.0f), out_Color, visibility);
+#endif
 }
\ No newline at end of file
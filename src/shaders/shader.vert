@@ -1,40 +1,98 @@
 #version 330 core
 
 layout (location = 0) in vec3 in_Position;
-layout (location = 1) in vec3 in_Color;
-layout (location = 2) in float in_Shininess;
+layout (location = 1) in vec2 in_Baked; // Occlusion & light, see LightBaker
+layout (location = 2) in float in_Material;
 layout (location = 3) in vec3 in_Normal;
+// Per-instance (defaults to the identity transform for non-instanced draws)
+layout (location = 4) in vec4 in_InstancePositionScale;
+layout (location = 5) in float in_InstanceRotation;
+layout (location = 6) in vec4 in_InstanceTint;
 
-uniform mat4 viewShader;
-uniform mat4 projectionShader;
-uniform vec3 viewPosition;
-uniform vec3 lightPosition;
+// Permutation defines, injected after #version - the defaults are the full shader
+#ifndef FOG
+#define FOG 1
+#endif
+#ifndef SPECULAR
+#define SPECULAR 1
+#endif
+#ifndef POINT_LIGHTS
+#define POINT_LIGHTS 1
+#endif
+#ifndef BAKED_LIGHTING
+#define BAKED_LIGHTING 0
+#endif
+#ifndef SHADOWS
+#define SHADOWS 1
+#endif
+
+const int MAX_MATERIALS = 256;
+
+layout (std140) uniform FrameConstants {
+    mat4 viewProjection;
+    vec4 cameraPosition;
+    vec4 lightPosition; // Already multiplied by viewProjection
+    vec4 viewPosition; // Already multiplied by viewProjection
+    vec4 lightColor;
+    vec4 skyColor;
+    vec4 fog; // x = density, y = gradient
+};
+
+// Indexed by in_Material
+struct Material {
+    vec4 color;
+    vec4 parameters; // x = shininess
+};
+
+layout (std140) uniform Materials {
+    Material materials[MAX_MATERIALS];
+};
 
 out vec4 ex_Color;
 out vec3 ex_FragPos;
 out vec3 ex_Normal;
 out vec3 ex_LightPosition;
 out vec3 ex_ViewPosition;
+#if SPECULAR
 out float ex_Shininess;
-out float ex_Visibility;
-
-const float density = 0.002f;
-const float gradient = 5.0f;
+#endif
+#if POINT_LIGHTS || SHADOWS
+out vec3 ex_WorldPosition;
+out vec3 ex_WorldNormal;
+#endif
+#if BAKED_LIGHTING > 0
+out vec2 ex_Baked;
+#endif
 
 void main() {
-    mat4 camera = projectionShader * viewShader;
-    vec4 position = camera * vec4(in_Position, 1.0);
+    // Instance transform - uniform scale, rotation around Y, translation
+    float rotationSin = sin(in_InstanceRotation);
+    float rotationCos = cos(in_InstanceRotation);
+    mat3 instanceRotation = mat3(
+        rotationCos, 0.0f, -rotationSin,
+        0.0f, 1.0f, 0.0f,
+        rotationSin, 0.0f, rotationCos
+    );
+    vec3 worldPosition = instanceRotation * (in_Position * in_InstancePositionScale.w) + in_InstancePositionScale.xyz;
+    vec3 worldNormal = instanceRotation * in_Normal;
+
+    vec4 position = viewProjection * vec4(worldPosition, 1.0);
     gl_Position = position;
 
-    ex_Color = vec4(in_Color, 1.0f);
+    Material material = materials[int(in_Material)];
+    ex_Color = vec4(material.color.rgb * in_InstanceTint.rgb, 1.0f);
     ex_FragPos = vec3(gl_Position);
-    ex_Normal = vec3(camera * vec4(in_Normal, 0.0));
-    ex_LightPosition = vec3(camera * vec4(lightPosition, 1.0f));
-    ex_ViewPosition = vec3(camera * vec4(viewPosition, 1.0f));
-    ex_Shininess = in_Shininess;
-
-    vec3 positionRelativeToCamera = ex_ViewPosition * position.xyz;
-    float distance = length(positionRelativeToCamera);
-    ex_Visibility = exp(-pow((distance * density), gradient));
-    ex_Visibility = clamp(ex_Visibility, 0.0f, 1.0f);
+    ex_Normal = vec3(viewProjection * vec4(worldNormal, 0.0));
+    ex_LightPosition = lightPosition.xyz;
+    ex_ViewPosition = viewPosition.xyz;
+#if SPECULAR
+    ex_Shininess = material.parameters.x;
+#endif
+#if POINT_LIGHTS || SHADOWS
+    ex_WorldPosition = worldPosition;
+    ex_WorldNormal = worldNormal;
+#endif
+#if BAKED_LIGHTING > 0
+    ex_Baked = in_Baked;
+#endif
 }
\ No newline at end of file
@@ -0,0 +1,20 @@
+#version 330 core
+
+// Shadow map pass - positions only, with the instance transform of the trees
+layout (location = 0) in vec3 in_Position;
+layout (location = 4) in vec4 in_InstancePositionScale;
+layout (location = 5) in float in_InstanceRotation;
+
+uniform mat4 lightViewProjection;
+
+void main() {
+    float rotationSin = sin(in_InstanceRotation);
+    float rotationCos = cos(in_InstanceRotation);
+    mat3 instanceRotation = mat3(
+        rotationCos, 0.0f, -rotationSin,
+        0.0f, 1.0f, 0.0f,
+        rotationSin, 0.0f, rotationCos
+    );
+    vec3 worldPosition = instanceRotation * (in_Position * in_InstancePositionScale.w) + in_InstancePositionScale.xyz;
+    gl_Position = lightViewProjection * vec4(worldPosition, 1.0);
+}
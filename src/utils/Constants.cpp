@@ -24,3 +24,20 @@ const float Constants::SHININESS_FRAMES = 8.0f;
 const float Constants::SHININESS_WINDOWS = 128.0f;
 const float Constants::SHININESS_ROOF = 32.0f;
 const float Constants::SHININESS_CHIMNEY = 2.0f;
+const float Constants::SHININESS_TREE_LEAVES = 4.0f;
+const float Constants::SHININESS_TREE_TRUNK = 2.0f;
+
+const Material Constants::MATERIAL_GRASS = {COLOR_GRASS, SHININESS_GRASS};
+const Material Constants::MATERIAL_ROAD = {COLOR_ROAD, SHININESS_ROAD};
+const Material Constants::MATERIAL_WALLS = {COLOR_WALLS, SHININESS_WALLS};
+const Material Constants::MATERIAL_DOOR = {COLOR_DOOR, SHININESS_DOOR};
+const Material Constants::MATERIAL_FRAMES = {COLOR_FRAMES, SHININESS_FRAMES};
+const Material Constants::MATERIAL_WINDOWS = {COLOR_WINDOWS, SHININESS_WINDOWS};
+const Material Constants::MATERIAL_ROOF = {COLOR_ROOF, SHININESS_ROOF};
+const Material Constants::MATERIAL_CHIMNEY = {COLOR_CHIMNEY, SHININESS_CHIMNEY};
+const Material Constants::MATERIAL_CHIMNEY_INNER = {COLOR_ROAD, SHININESS_CHIMNEY};
+const Material Constants::MATERIAL_TREE_LEAVES = {COLOR_TREE_LEAVES, SHININESS_TREE_LEAVES};
+const Material Constants::MATERIAL_TREE_TRUNK = {COLOR_TREE_TRUNK, SHININESS_TREE_TRUNK};
+
+// Fully fogged beyond a view depth of ~3600
+const Fog Constants::FOG = {0.0004f, 5.0f};
@@ -5,6 +5,8 @@
 #include <glm/ext/matrix_clip_space.hpp>
 #include <GL/glew.h>
 #include "color/Color.h"
+#include "color/Material.h"
+#include "render/Fog.h"
 
 using namespace glm;
 
@@ -37,6 +39,24 @@ public:
     static const float SHININESS_WINDOWS;
     static const float SHININESS_ROOF;
     static const float SHININESS_CHIMNEY;
+    static const float SHININESS_TREE_LEAVES;
+    static const float SHININESS_TREE_TRUNK;
+
+    // Materials
+    static const Material MATERIAL_GRASS;
+    static const Material MATERIAL_ROAD;
+    static const Material MATERIAL_WALLS;
+    static const Material MATERIAL_DOOR;
+    static const Material MATERIAL_FRAMES;
+    static const Material MATERIAL_WINDOWS;
+    static const Material MATERIAL_ROOF;
+    static const Material MATERIAL_CHIMNEY;
+    static const Material MATERIAL_CHIMNEY_INNER;
+    static const Material MATERIAL_TREE_LEAVES;
+    static const Material MATERIAL_TREE_TRUNK;
+
+    // Fog
+    static const Fog FOG;
 };
 
 #endif //GC_CONSTANTS_H
\ No newline at end of file
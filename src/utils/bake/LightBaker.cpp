@@ -0,0 +1,89 @@
+#include "LightBaker.h"
+#include <chrono>
+#include <cmath>
+
+void LightBaker::addOccluders(const MeshView &mesh, const DrawRange &range, vec3 translation) {
+    for (auto i = range.indexOffset; i < range.indexOffset + range.indexCount; i++) {
+        occluderVertices.push_back(mesh.vertices[mesh.indices[i] + range.baseVertex].position + translation);
+    }
+}
+
+void LightBaker::buildOccluders() {
+    bvh.build(occluderVertices);
+}
+
+size_t LightBaker::getOccluderTriangleCount() const {
+    return bvh.getTriangleCount();
+}
+
+LightBakeStats LightBaker::bake(ThreadPool &threadPool, pmr::vector<PackedVertex> &vertices, bool isLit,
+                                vec3 lightPosition) {
+    const auto bakeStart = chrono::steady_clock::now();
+    const auto directions = getHemisphereDirections();
+
+    threadPool.parallelFor(vertices.size(), [&](size_t begin, size_t end) {
+        for (auto i = begin; i < end; i++) {
+            auto &vertex = vertices[i];
+            const auto normal = VertexFormat::unpackNormal(vertex.normal);
+            if (dot(normal, normal) == 0.0f) {
+                continue;
+            }
+            const auto n = normalize(normal);
+            const auto origin = vertex.position + n * RAY_OFFSET;
+
+            // Orthonormal basis around the normal (Duff et al. 2017)
+            const auto sign = copysignf(1.0f, n.z);
+            const auto a = -1.0f / (sign + n.z);
+            const auto b = n.x * n.y * a;
+            const auto tangent = vec3(1.0f + sign * n.x * n.x * a, sign * b, -sign * n.x);
+            const auto bitangent = vec3(b, sign + n.y * n.y * a, -n.y);
+
+            auto unoccludedCount = 0;
+            for (const auto &direction: directions) {
+                const auto rayDirection = tangent * direction.x + bitangent * direction.y + n * direction.z;
+                if (!bvh.isOccluded(origin, rayDirection, OCCLUSION_DISTANCE)) {
+                    unoccludedCount++;
+                }
+            }
+            vertex.occlusion = (GLubyte) std::round(255.0f * (float) unoccludedCount / (float) directions.size());
+
+            vertex.light = 0;
+            if (isLit) {
+                const auto toLight = lightPosition - origin;
+                const auto lightDistance = length(toLight);
+                const auto lightDirection = toLight / lightDistance;
+                const auto diffuse = std::max(dot(n, lightDirection), 0.0f);
+                if (diffuse > 0.0f && !bvh.isOccluded(origin, lightDirection, lightDistance)) {
+                    vertex.light = (GLubyte) std::round(255.0f * diffuse);
+                }
+            }
+        }
+    }, 256);
+
+    LightBakeStats stats;
+    stats.vertexCount = vertices.size();
+    stats.rayCount = vertices.size() * (directions.size() + (isLit ? 1 : 0));
+    stats.milliseconds = chrono::duration<float, milli>(chrono::steady_clock::now() - bakeStart).count();
+    return stats;
+}
+
+vector<vec3> LightBaker::getHemisphereDirections() {
+    // Hammersley points mapped to a cosine-weighted hemisphere, so the unoccluded fraction weighs every direction
+    // by its contribution to the diffuse ambient light
+    vector<vec3> directions(OCCLUSION_RAY_COUNT);
+    for (auto i = 0; i < OCCLUSION_RAY_COUNT; i++) {
+        auto bits = (unsigned) i;
+        bits = (bits << 16u) | (bits >> 16u);
+        bits = ((bits & 0x55555555u) << 1u) | ((bits & 0xAAAAAAAAu) >> 1u);
+        bits = ((bits & 0x33333333u) << 2u) | ((bits & 0xCCCCCCCCu) >> 2u);
+        bits = ((bits & 0x0F0F0F0Fu) << 4u) | ((bits & 0xF0F0F0F0u) >> 4u);
+        bits = ((bits & 0x00FF00FFu) << 8u) | ((bits & 0xFF00FF00u) >> 8u);
+        const auto u = ((float) i + 0.5f) / (float) OCCLUSION_RAY_COUNT;
+        const auto v = (float) bits * 2.3283064365386963e-10f; // Radical inverse, / 2^32
+
+        const auto radius = sqrtf(u);
+        const auto angle = 2.0f * (float) M_PI * v;
+        directions[i] = vec3(radius * cosf(angle), radius * sinf(angle), sqrtf(1.0f - u));
+    }
+    return directions;
+}
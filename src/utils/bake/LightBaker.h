@@ -0,0 +1,50 @@
+#ifndef GC_LIGHTBAKER_H
+#define GC_LIGHTBAKER_H
+
+#include <glm/glm.hpp>
+#include <vector>
+#include <memory_resource>
+#include "TriangleBvh.h"
+#include "../mesh/MeshBuilder.h"
+#include "../jobs/ThreadPool.h"
+
+using namespace std;
+using namespace glm;
+
+struct LightBakeStats {
+    size_t vertexCount = 0;
+    size_t rayCount = 0;
+    float milliseconds = 0.0f;
+};
+
+// Offline lighting of static geometry - every vertex gets its ambient occlusion (the unoccluded fraction of a
+// cosine-weighted hemisphere of rays) and optionally the diffuse light from a point light, zeroed when a shadow ray
+// towards it is blocked. Rays are traced against the occluders' TriangleBvh, the vertices are split among the
+// thread pool's threads. The results go into PackedVertex::occlusion & light, so they are cached with the mesh.
+class LightBaker {
+public:
+    static constexpr int OCCLUSION_RAY_COUNT = 32;
+    // Farther hits don't darken, so open ground stays fully lit next to distant walls
+    static constexpr float OCCLUSION_DISTANCE = 150.0f;
+    // Ray origins are moved along the normal, so rays don't hit the surface they start on
+    static constexpr float RAY_OFFSET = 0.05f;
+
+    // Triangles of the mesh's range, moved by translation
+    void addOccluders(const MeshView &mesh, const DrawRange &range, vec3 translation = vec3(0.0f));
+
+    void buildOccluders();
+
+    size_t getOccluderTriangleCount() const;
+
+    // Occlusion for every vertex, and the light from lightPosition when isLit (otherwise light is left at 0)
+    LightBakeStats bake(ThreadPool &threadPool, pmr::vector<PackedVertex> &vertices, bool isLit, vec3 lightPosition);
+
+private:
+    vector<vec3> occluderVertices;
+    TriangleBvh bvh;
+
+    // Occlusion directions around +Z, shared by all vertices
+    static vector<vec3> getHemisphereDirections();
+};
+
+#endif //GC_LIGHTBAKER_H
@@ -0,0 +1,202 @@
+#include "TriangleBvh.h"
+#include <algorithm>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define GC_HAS_SSE 1
+#endif
+
+void TriangleBvh::build(const vector<vec3> &triangleVertices) {
+    nodes.clear();
+    packets.clear();
+    triangleCount = triangleVertices.size() / 3;
+
+    vector<unsigned> triangles(triangleCount);
+    vector<vec3> centroids(triangleCount);
+    for (auto i = 0; i < triangleCount; i++) {
+        triangles[i] = i;
+        centroids[i] = (triangleVertices[3 * i] + triangleVertices[3 * i + 1] + triangleVertices[3 * i + 2]) / 3.0f;
+    }
+
+    if (triangleCount > 0) {
+        nodes.reserve(2 * triangleCount / MAX_LEAF_TRIANGLES + 1);
+        packets.reserve(2 * triangleCount / PACKET_SIZE + 1);
+        buildNode(triangles, 0, (unsigned) triangleCount, triangleVertices, centroids);
+    }
+}
+
+unsigned TriangleBvh::buildNode(vector<unsigned> &triangles, unsigned first, unsigned count,
+                                const vector<vec3> &vertices, const vector<vec3> &centroids) {
+    const auto nodeIndex = (unsigned) nodes.size();
+    nodes.push_back(Node{AABB(), 0, 0, 0});
+
+    AABB nodeBounds, centroidBounds;
+    for (auto i = first; i < first + count; i++) {
+        for (auto corner = 0; corner < 3; corner++) {
+            nodeBounds.expand(vertices[3 * triangles[i] + corner]);
+        }
+        centroidBounds.expand(centroids[triangles[i]]);
+    }
+    nodes[nodeIndex].bounds = nodeBounds;
+
+    if (count <= MAX_LEAF_TRIANGLES) {
+        nodes[nodeIndex].firstPacket = (unsigned) packets.size();
+        for (auto packetStart = first; packetStart < first + count; packetStart += PACKET_SIZE) {
+            TrianglePacket packet{};
+            for (auto lane = 0; lane < PACKET_SIZE && packetStart + lane < first + count; lane++) {
+                const auto *triangle = &vertices[3 * triangles[packetStart + lane]];
+                const auto edge1 = triangle[1] - triangle[0];
+                const auto edge2 = triangle[2] - triangle[0];
+                for (auto axis = 0; axis < 3; axis++) {
+                    packet.vertex0[axis][lane] = triangle[0][axis];
+                    packet.edge1[axis][lane] = edge1[axis];
+                    packet.edge2[axis][lane] = edge2[axis];
+                }
+            }
+            packets.push_back(packet);
+            nodes[nodeIndex].packetCount++;
+        }
+        return nodeIndex;
+    }
+
+    // Split at the median along the longest axis of the centroids
+    const auto size = centroidBounds.max - centroidBounds.min;
+    auto axis = 0;
+    if (size.y > size[axis]) {
+        axis = 1;
+    }
+    if (size.z > size[axis]) {
+        axis = 2;
+    }
+
+    const auto begin = triangles.begin() + first;
+    const auto middle = begin + count / 2;
+    nth_element(begin, middle, begin + count, [&](unsigned a, unsigned b) {
+        return centroids[a][axis] < centroids[b][axis];
+    });
+
+    const auto leftCount = count / 2;
+    buildNode(triangles, first, leftCount, vertices, centroids);
+    const auto rightChild = buildNode(triangles, first + leftCount, count - leftCount, vertices, centroids);
+    nodes[nodeIndex].rightChild = rightChild;
+    return nodeIndex;
+}
+
+size_t TriangleBvh::getTriangleCount() const {
+    return triangleCount;
+}
+
+size_t TriangleBvh::getNodeCount() const {
+    return nodes.size();
+}
+
+bool TriangleBvh::isOccluded(vec3 origin, vec3 direction, float maxDistance) const {
+    if (nodes.empty()) {
+        return false;
+    }
+
+    // Division by 0 gives infinities, which the slab test handles
+    const auto inverseDirection = 1.0f / direction;
+    unsigned stack[64];
+    auto stackSize = 0;
+    stack[stackSize++] = 0;
+    while (stackSize > 0) {
+        const auto nodeIndex = stack[--stackSize];
+        const auto &node = nodes[nodeIndex];
+        if (!intersectsBox(node.bounds, origin, inverseDirection, maxDistance)) {
+            continue;
+        }
+
+        if (node.packetCount > 0) {
+            for (auto i = node.firstPacket; i < node.firstPacket + node.packetCount; i++) {
+                if (intersectsPacket(packets[i], origin, direction, maxDistance)) {
+                    return true;
+                }
+            }
+        } else {
+            stack[stackSize++] = node.rightChild;
+            stack[stackSize++] = nodeIndex + 1;
+        }
+    }
+    return false;
+}
+
+bool TriangleBvh::intersectsBox(const AABB &box, vec3 origin, vec3 inverseDirection, float maxDistance) {
+    const auto near = (box.min - origin) * inverseDirection;
+    const auto far = (box.max - origin) * inverseDirection;
+    const auto entry = glm::min(near, far);
+    const auto exit = glm::max(near, far);
+    const auto entryDistance = std::max({entry.x, entry.y, entry.z, 0.0f});
+    const auto exitDistance = std::min({exit.x, exit.y, exit.z, maxDistance});
+    return entryDistance <= exitDistance;
+}
+
+bool TriangleBvh::intersectsPacket(const TrianglePacket &packet, vec3 origin, vec3 direction, float maxDistance) {
+#ifdef GC_HAS_SSE
+    const auto directionX = _mm_set1_ps(direction.x);
+    const auto directionY = _mm_set1_ps(direction.y);
+    const auto directionZ = _mm_set1_ps(direction.z);
+    const auto edge1X = _mm_load_ps(packet.edge1[0]);
+    const auto edge1Y = _mm_load_ps(packet.edge1[1]);
+    const auto edge1Z = _mm_load_ps(packet.edge1[2]);
+    const auto edge2X = _mm_load_ps(packet.edge2[0]);
+    const auto edge2Y = _mm_load_ps(packet.edge2[1]);
+    const auto edge2Z = _mm_load_ps(packet.edge2[2]);
+
+    // p = direction x edge2, determinant = edge1 . p
+    const auto pX = _mm_sub_ps(_mm_mul_ps(directionY, edge2Z), _mm_mul_ps(directionZ, edge2Y));
+    const auto pY = _mm_sub_ps(_mm_mul_ps(directionZ, edge2X), _mm_mul_ps(directionX, edge2Z));
+    const auto pZ = _mm_sub_ps(_mm_mul_ps(directionX, edge2Y), _mm_mul_ps(directionY, edge2X));
+    const auto determinant = _mm_add_ps(_mm_add_ps(_mm_mul_ps(edge1X, pX), _mm_mul_ps(edge1Y, pY)),
+                                        _mm_mul_ps(edge1Z, pZ));
+    const auto inverseDeterminant = _mm_div_ps(_mm_set1_ps(1.0f), determinant);
+
+    // s = origin - vertex0, u = (s . p) / determinant
+    const auto sX = _mm_sub_ps(_mm_set1_ps(origin.x), _mm_load_ps(packet.vertex0[0]));
+    const auto sY = _mm_sub_ps(_mm_set1_ps(origin.y), _mm_load_ps(packet.vertex0[1]));
+    const auto sZ = _mm_sub_ps(_mm_set1_ps(origin.z), _mm_load_ps(packet.vertex0[2]));
+    const auto u = _mm_mul_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(sX, pX), _mm_mul_ps(sY, pY)), _mm_mul_ps(sZ, pZ)),
+                              inverseDeterminant);
+
+    // q = s x edge1, v = (direction . q) / determinant, t = (edge2 . q) / determinant
+    const auto qX = _mm_sub_ps(_mm_mul_ps(sY, edge1Z), _mm_mul_ps(sZ, edge1Y));
+    const auto qY = _mm_sub_ps(_mm_mul_ps(sZ, edge1X), _mm_mul_ps(sX, edge1Z));
+    const auto qZ = _mm_sub_ps(_mm_mul_ps(sX, edge1Y), _mm_mul_ps(sY, edge1X));
+    const auto v = _mm_mul_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(directionX, qX), _mm_mul_ps(directionY, qY)),
+                                         _mm_mul_ps(directionZ, qZ)), inverseDeterminant);
+    const auto t = _mm_mul_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(edge2X, qX), _mm_mul_ps(edge2Y, qY)),
+                                         _mm_mul_ps(edge2Z, qZ)), inverseDeterminant);
+
+    // Degenerate lanes have a determinant of 0, their NaNs & infinities fail the comparisons below anyway
+    const auto zero = _mm_setzero_ps();
+    const auto absoluteDeterminant = _mm_andnot_ps(_mm_set1_ps(-0.0f), determinant);
+    auto hit = _mm_cmpgt_ps(absoluteDeterminant, zero);
+    hit = _mm_and_ps(hit, _mm_cmpge_ps(u, zero));
+    hit = _mm_and_ps(hit, _mm_cmpge_ps(v, zero));
+    hit = _mm_and_ps(hit, _mm_cmple_ps(_mm_add_ps(u, v), _mm_set1_ps(1.0f)));
+    hit = _mm_and_ps(hit, _mm_cmpgt_ps(t, zero));
+    hit = _mm_and_ps(hit, _mm_cmplt_ps(t, _mm_set1_ps(maxDistance)));
+    return _mm_movemask_ps(hit) != 0;
+#else
+    for (auto lane = 0; lane < PACKET_SIZE; lane++) {
+        const auto edge1 = vec3(packet.edge1[0][lane], packet.edge1[1][lane], packet.edge1[2][lane]);
+        const auto edge2 = vec3(packet.edge2[0][lane], packet.edge2[1][lane], packet.edge2[2][lane]);
+        const auto p = cross(direction, edge2);
+        const auto determinant = dot(edge1, p);
+        if (determinant == 0.0f) {
+            continue;
+        }
+
+        const auto inverseDeterminant = 1.0f / determinant;
+        const auto s = origin - vec3(packet.vertex0[0][lane], packet.vertex0[1][lane], packet.vertex0[2][lane]);
+        const auto u = dot(s, p) * inverseDeterminant;
+        const auto q = cross(s, edge1);
+        const auto v = dot(direction, q) * inverseDeterminant;
+        const auto t = dot(edge2, q) * inverseDeterminant;
+        if (u >= 0.0f && v >= 0.0f && u + v <= 1.0f && t > 0.0f && t < maxDistance) {
+            return true;
+        }
+    }
+    return false;
+#endif
+}
@@ -0,0 +1,58 @@
+#ifndef GC_TRIANGLEBVH_H
+#define GC_TRIANGLEBVH_H
+
+#include <glm/glm.hpp>
+#include <vector>
+#include "../culling/AABB.h"
+
+using namespace std;
+using namespace glm;
+
+// Bounding volume hierarchy over a triangle soup for shadow & occlusion rays, built like Bvh (median split of the
+// centroids along the longest axis). Leaves keep their triangles in packets of 4, laid out so one ray is tested
+// against the 4 of them at once with SSE (Möller-Trumbore).
+class TriangleBvh {
+public:
+    // Three vertices per triangle
+    void build(const vector<vec3> &triangleVertices);
+
+    size_t getTriangleCount() const;
+
+    size_t getNodeCount() const;
+
+    // Whether anything is hit along origin + t * direction for 0 < t < maxDistance, direction needn't be unit length
+    bool isOccluded(vec3 origin, vec3 direction, float maxDistance) const;
+
+private:
+    static const unsigned PACKET_SIZE = 4;
+    static const unsigned MAX_LEAF_TRIANGLES = 2 * PACKET_SIZE;
+
+    struct Node {
+        AABB bounds;
+        // Leaves reference packets[firstPacket, firstPacket + packetCount), inner nodes have their left child right
+        // after them and the right child at rightChild
+        unsigned firstPacket;
+        unsigned packetCount;
+        unsigned rightChild;
+    };
+
+    // Structure of arrays, [axis][lane] - unused lanes are degenerate and never hit
+    struct alignas(16) TrianglePacket {
+        float vertex0[3][PACKET_SIZE];
+        float edge1[3][PACKET_SIZE];
+        float edge2[3][PACKET_SIZE];
+    };
+
+    vector<Node> nodes;
+    vector<TrianglePacket> packets;
+    size_t triangleCount = 0;
+
+    unsigned buildNode(vector<unsigned> &triangles, unsigned first, unsigned count, const vector<vec3> &vertices,
+                       const vector<vec3> &centroids);
+
+    static bool intersectsBox(const AABB &box, vec3 origin, vec3 inverseDirection, float maxDistance);
+
+    static bool intersectsPacket(const TrianglePacket &packet, vec3 origin, vec3 direction, float maxDistance);
+};
+
+#endif //GC_TRIANGLEBVH_H
@@ -0,0 +1,19 @@
+#include "ContentHash.h"
+
+void ContentHash::add(const void *data, size_t size) {
+    const auto *bytes = static_cast<const unsigned char *>(data);
+    for (size_t i = 0; i < size; i++) {
+        value ^= bytes[i];
+        value *= 1099511628211ull;
+    }
+}
+
+void ContentHash::add(const string &text) {
+    add(text.data(), text.size());
+    // Separator, so ("ab", "c") and ("a", "bc") differ
+    addValue(text.size());
+}
+
+uint64_t ContentHash::get() const {
+    return value;
+}
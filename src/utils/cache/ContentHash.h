@@ -0,0 +1,29 @@
+#ifndef GC_CONTENTHASH_H
+#define GC_CONTENTHASH_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+using namespace std;
+
+// 64-bit FNV-1a, for cache keys - not for anything security related
+class ContentHash {
+private:
+    uint64_t value = 14695981039346656037ull;
+
+public:
+    void add(const void *data, size_t size);
+
+    void add(const string &text);
+
+    // Raw bytes of a trivially copyable value
+    template<typename T>
+    void addValue(const T &data) {
+        add(&data, sizeof data);
+    }
+
+    uint64_t get() const;
+};
+
+#endif //GC_CONTENTHASH_H
@@ -0,0 +1,150 @@
+#include "ProgramCache.h"
+#include "ContentHash.h"
+#include "../render/ShadersUtils.h"
+#include <chrono>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <vector>
+
+namespace {
+    const char MAGIC[4] = {'G', 'C', 'P', 'B'};
+
+    struct ProgramBinaryHeader {
+        char magic[4];
+        uint32_t version;
+        uint64_t key;
+        uint32_t format;
+        uint32_t length;
+    };
+
+    const char *getString(GLenum name) {
+        const auto *value = reinterpret_cast<const char *>(glGetString(name));
+        return value != nullptr ? value : "";
+    }
+}
+
+void ProgramCache::initialize(const string &directory, bool isEnabled) {
+    this->directory = directory;
+    driverId = string(getString(GL_VENDOR)) + "|" + getString(GL_RENDERER) + "|" + getString(GL_VERSION);
+
+    GLint formatCount = 0;
+    if (GLEW_ARB_get_program_binary) {
+        glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formatCount);
+    }
+    this->isEnabled = isEnabled && formatCount > 0;
+    if (isEnabled && !this->isEnabled) {
+        cout << "Program cache: not supported by the driver" << endl;
+        return;
+    }
+
+    if (this->isEnabled) {
+        error_code error;
+        filesystem::create_directories(directory, error);
+        if (error) {
+            cout << "ERROR::PROGRAM_CACHE::COULD_NOT_CREATE_DIRECTORY " << directory << endl;
+            this->isEnabled = false;
+        }
+    }
+}
+
+string ProgramCache::getPath(uint64_t key) const {
+    char name[32];
+    snprintf(name, sizeof name, "%016llx.bin", (unsigned long long) key);
+    return (filesystem::path(directory) / name).string();
+}
+
+GLuint ProgramCache::loadProgram(const char *vertexShaderPath, const char *fragShaderPath) {
+    return loadProgram(ShadersUtils::readFile(vertexShaderPath), ShadersUtils::readFile(fragShaderPath));
+}
+
+GLuint ProgramCache::loadProgram(const string &vertexSource, const string &fragSource) {
+    const auto start = chrono::steady_clock::now();
+    const auto elapsedMilliseconds = [&start] {
+        return chrono::duration<float, milli>(chrono::steady_clock::now() - start).count();
+    };
+
+    ContentHash hash;
+    hash.add(vertexSource);
+    hash.add(fragSource);
+    hash.add(driverId);
+    const auto key = hash.get();
+
+    if (isEnabled) {
+        const auto programId = loadBinary(key);
+        if (programId != 0) {
+            glUseProgram(programId);
+            stats.hitCount++;
+            stats.hitMilliseconds += elapsedMilliseconds();
+            return programId;
+        }
+    }
+
+    const auto programId = ShadersUtils::compileProgram(vertexSource, fragSource, isEnabled);
+    // Querying the link status also waits for the driver to finish
+    if (ShadersUtils::isLinked(programId) && isEnabled) {
+        saveBinary(key, programId);
+    }
+    glUseProgram(programId);
+    stats.missCount++;
+    stats.compileMilliseconds += elapsedMilliseconds();
+    return programId;
+}
+
+GLuint ProgramCache::loadBinary(uint64_t key) const {
+    ifstream file(getPath(key), ios::binary);
+    if (!file) {
+        return 0;
+    }
+
+    ProgramBinaryHeader header{};
+    file.read(reinterpret_cast<char *>(&header), sizeof header);
+    if (!file || memcmp(header.magic, MAGIC, sizeof MAGIC) != 0 || header.version != VERSION || header.key != key) {
+        return 0;
+    }
+    vector<char> binary(header.length);
+    file.read(binary.data(), (streamsize) binary.size());
+    if (!file) {
+        return 0;
+    }
+
+    // Rejected if the driver changed in a way the key doesn't capture
+    const auto programId = glCreateProgram();
+    glProgramBinary(programId, header.format, binary.data(), (GLsizei) binary.size());
+    if (!ShadersUtils::isLinked(programId)) {
+        glDeleteProgram(programId);
+        return 0;
+    }
+    return programId;
+}
+
+void ProgramCache::saveBinary(uint64_t key, GLuint programId) const {
+    GLint length = 0;
+    glGetProgramiv(programId, GL_PROGRAM_BINARY_LENGTH, &length);
+    if (length <= 0) {
+        return;
+    }
+
+    vector<char> binary((size_t) length);
+    GLenum format = 0;
+    glGetProgramBinary(programId, length, nullptr, &format, binary.data());
+
+    ProgramBinaryHeader header{};
+    memcpy(header.magic, MAGIC, sizeof MAGIC);
+    header.version = VERSION;
+    header.key = key;
+    header.format = format;
+    header.length = (uint32_t) length;
+
+    ofstream file(getPath(key), ios::binary | ios::trunc);
+    file.write(reinterpret_cast<const char *>(&header), sizeof header);
+    file.write(binary.data(), (streamsize) binary.size());
+    if (!file) {
+        cout << "ERROR::PROGRAM_CACHE::WRITE_FAILED " << getPath(key) << endl;
+    }
+}
+
+const ProgramCacheStats &ProgramCache::getStats() const {
+    return stats;
+}
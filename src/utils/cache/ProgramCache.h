@@ -0,0 +1,47 @@
+#ifndef GC_PROGRAMCACHE_H
+#define GC_PROGRAMCACHE_H
+
+#include <GL/glew.h>
+#include <cstdint>
+#include <string>
+
+using namespace std;
+
+struct ProgramCacheStats {
+    int hitCount = 0;
+    int missCount = 0;
+    float hitMilliseconds = 0.0f; // Spent loading binaries
+    float compileMilliseconds = 0.0f; // Spent compiling & linking from source
+};
+
+// Linked programs saved with glGetProgramBinary, one file per program. The key covers the sources and the driver
+// (vendor, renderer, version), anything else that makes a binary unusable is caught by glProgramBinary failing to
+// link, in which case the program is compiled from source and the file replaced.
+class ProgramCache {
+private:
+    string directory;
+    bool isEnabled = false;
+    string driverId;
+    ProgramCacheStats stats;
+
+    string getPath(uint64_t key) const;
+
+    GLuint loadBinary(uint64_t key) const;
+
+    void saveBinary(uint64_t key, GLuint programId) const;
+
+public:
+    static const uint32_t VERSION = 1;
+
+    // Disabled if the driver can't give back program binaries
+    void initialize(const string &directory, bool isEnabled = true);
+
+    // Same as ShadersUtils::loadShaders, going through the cache
+    GLuint loadProgram(const char *vertexShaderPath, const char *fragShaderPath);
+
+    GLuint loadProgram(const string &vertexSource, const string &fragSource);
+
+    const ProgramCacheStats &getStats() const;
+};
+
+#endif //GC_PROGRAMCACHE_H
@@ -0,0 +1,215 @@
+#include "SceneCache.h"
+#include <cstring>
+#include <cstdio>
+#include <fstream>
+#include <algorithm>
+#include <iostream>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace {
+    const char MAGIC[4] = {'G', 'C', 'S', 'C'};
+    const size_t BLOCK_ALIGNMENT = 16;
+
+    size_t align(size_t offset) {
+        return (offset + BLOCK_ALIGNMENT - 1) / BLOCK_ALIGNMENT * BLOCK_ALIGNMENT;
+    }
+}
+
+bool SceneCache::write(const string &path, uint64_t contentHash, const vector<MeshView> &meshes,
+                       const vector<Material> &materials) {
+    if (materials.size() > MAX_MATERIALS) {
+        cout << "ERROR::SCENE_CACHE::TOO_MANY_MATERIALS" << endl;
+        return false;
+    }
+
+    SceneCacheHeader header{};
+    memcpy(header.magic, MAGIC, sizeof MAGIC);
+    header.version = VERSION;
+    header.contentHash = contentHash;
+    header.vertexSize = sizeof(PackedVertex);
+    header.drawRangeSize = sizeof(DrawRange);
+    header.meshCount = (uint32_t) meshes.size();
+    header.materialCount = (uint32_t) materials.size();
+    copy(materials.begin(), materials.end(), header.materials);
+
+    // Layout
+    vector<SceneCacheMesh> entries(meshes.size());
+    auto offset = align(sizeof(SceneCacheHeader) + entries.size() * sizeof(SceneCacheMesh));
+    for (auto i = 0; i < meshes.size(); i++) {
+        auto &entry = entries[i];
+        entry.vertexOffset = offset;
+        entry.vertexCount = meshes[i].vertexCount;
+        offset = align(offset + meshes[i].vertexCount * sizeof(PackedVertex));
+        entry.indexOffset = offset;
+        entry.indexCount = meshes[i].indexCount;
+        offset = align(offset + meshes[i].indexCount * sizeof(GLuint));
+        entry.drawRangeOffset = offset;
+        entry.drawRangeCount = meshes[i].drawRanges.size();
+        offset = align(offset + meshes[i].drawRanges.size() * sizeof(DrawRange));
+        entry.bounds = meshes[i].bounds;
+    }
+
+    // Written next to the destination and renamed, so a reader never sees a partial file
+    const auto temporaryPath = path + ".tmp";
+    ofstream file(temporaryPath, ios::binary | ios::trunc);
+    if (!file) {
+        cout << "ERROR::SCENE_CACHE::COULD_NOT_CREATE " << temporaryPath << endl;
+        return false;
+    }
+
+    const auto writeAt = [&file](size_t position, const void *bytes, size_t count) {
+        const auto current = (size_t) file.tellp();
+        if (position > current) {
+            const char padding[BLOCK_ALIGNMENT] = {};
+            file.write(padding, (streamsize) (position - current));
+        }
+        file.write(static_cast<const char *>(bytes), (streamsize) count);
+    };
+    writeAt(0, &header, sizeof header);
+    writeAt(sizeof header, entries.data(), entries.size() * sizeof(SceneCacheMesh));
+    for (auto i = 0; i < meshes.size(); i++) {
+        writeAt(entries[i].vertexOffset, meshes[i].vertices, meshes[i].vertexCount * sizeof(PackedVertex));
+        writeAt(entries[i].indexOffset, meshes[i].indices, meshes[i].indexCount * sizeof(GLuint));
+        writeAt(entries[i].drawRangeOffset, meshes[i].drawRanges.data(),
+                meshes[i].drawRanges.size() * sizeof(DrawRange));
+    }
+    file.close();
+    if (!file) {
+        cout << "ERROR::SCENE_CACHE::WRITE_FAILED " << temporaryPath << endl;
+        remove(temporaryPath.c_str());
+        return false;
+    }
+
+    remove(path.c_str());
+    if (rename(temporaryPath.c_str(), path.c_str()) != 0) {
+        cout << "ERROR::SCENE_CACHE::RENAME_FAILED " << path << endl;
+        return false;
+    }
+    return true;
+}
+
+bool SceneCache::open(const string &path, uint64_t contentHash) {
+    close();
+
+#ifdef _WIN32
+    ifstream file(path, ios::binary | ios::ate);
+    if (!file) {
+        return false;
+    }
+    fileContents.resize((size_t) file.tellg());
+    file.seekg(0);
+    file.read(fileContents.data(), (streamsize) fileContents.size());
+    data = fileContents.data();
+    size = fileContents.size();
+#else
+    const auto descriptor = ::open(path.c_str(), O_RDONLY);
+    if (descriptor < 0) {
+        return false;
+    }
+
+    struct stat status{};
+    if (fstat(descriptor, &status) != 0 || status.st_size == 0) {
+        ::close(descriptor);
+        return false;
+    }
+
+    auto *mapping = mmap(nullptr, (size_t) status.st_size, PROT_READ, MAP_PRIVATE, descriptor, 0);
+    ::close(descriptor);
+    if (mapping == MAP_FAILED) {
+        return false;
+    }
+    data = static_cast<const char *>(mapping);
+    size = (size_t) status.st_size;
+#endif
+
+    if (!isValid(contentHash)) {
+        close();
+        return false;
+    }
+    return true;
+}
+
+bool SceneCache::isValid(uint64_t contentHash) const {
+    if (size < sizeof(SceneCacheHeader)) {
+        return false;
+    }
+
+    const auto &header = getHeader();
+    if (memcmp(header.magic, MAGIC, sizeof MAGIC) != 0 || header.version != VERSION ||
+        header.contentHash != contentHash || header.vertexSize != sizeof(PackedVertex) ||
+        header.drawRangeSize != sizeof(DrawRange) || header.materialCount > MAX_MATERIALS ||
+        sizeof(SceneCacheHeader) + header.meshCount * sizeof(SceneCacheMesh) > size) {
+        return false;
+    }
+
+    // Every block has to lie within the file
+    const auto isInside = [this](uint64_t offset, uint64_t count, size_t elementSize) {
+        return offset <= size && count <= (size - offset) / elementSize;
+    };
+    for (auto i = 0; i < header.meshCount; i++) {
+        const auto &entry = getMeshEntry(i);
+        if (!isInside(entry.vertexOffset, entry.vertexCount, sizeof(PackedVertex)) ||
+            !isInside(entry.indexOffset, entry.indexCount, sizeof(GLuint)) ||
+            !isInside(entry.drawRangeOffset, entry.drawRangeCount, sizeof(DrawRange))) {
+            return false;
+        }
+    }
+    return true;
+}
+
+const SceneCacheHeader &SceneCache::getHeader() const {
+    return *reinterpret_cast<const SceneCacheHeader *>(data);
+}
+
+const SceneCacheMesh &SceneCache::getMeshEntry(size_t index) const {
+    return reinterpret_cast<const SceneCacheMesh *>(data + sizeof(SceneCacheHeader))[index];
+}
+
+size_t SceneCache::getMeshCount() const {
+    return data == nullptr ? 0 : getHeader().meshCount;
+}
+
+MeshView SceneCache::getMesh(size_t index) const {
+    const auto &entry = getMeshEntry(index);
+    const auto *drawRanges = reinterpret_cast<const DrawRange *>(data + entry.drawRangeOffset);
+
+    MeshView view;
+    view.vertices = reinterpret_cast<const PackedVertex *>(data + entry.vertexOffset);
+    view.vertexCount = entry.vertexCount;
+    view.indices = reinterpret_cast<const GLuint *>(data + entry.indexOffset);
+    view.indexCount = entry.indexCount;
+    view.drawRanges.assign(drawRanges, drawRanges + entry.drawRangeCount);
+    view.bounds = entry.bounds;
+    return view;
+}
+
+vector<Material> SceneCache::getMaterials() const {
+    const auto &header = getHeader();
+    return vector<Material>(header.materials, header.materials + header.materialCount);
+}
+
+size_t SceneCache::getSize() const {
+    return size;
+}
+
+void SceneCache::close() {
+#ifdef _WIN32
+    fileContents.clear();
+#else
+    if (data != nullptr) {
+        munmap(const_cast<char *>(data), size);
+    }
+#endif
+    data = nullptr;
+    size = 0;
+}
+
+SceneCache::~SceneCache() {
+    close();
+}
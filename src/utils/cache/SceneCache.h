@@ -0,0 +1,74 @@
+#ifndef GC_SCENECACHE_H
+#define GC_SCENECACHE_H
+
+#include <GL/glew.h>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "../mesh/MeshBuilder.h"
+#include "../color/Material.h"
+
+using namespace std;
+
+// Binary scene file, written once after generation and memory-mapped on later runs:
+//   SceneCacheHeader
+//   SceneCacheMesh * meshCount
+//   per mesh: vertex block, index block, draw range block (each 16 byte aligned)
+// Everything is stored in the in-memory layout, so the blocks are used in place.
+struct SceneCacheHeader {
+    char magic[4];
+    uint32_t version;
+    uint64_t contentHash;
+    uint32_t vertexSize;
+    uint32_t drawRangeSize;
+    uint32_t meshCount;
+    uint32_t materialCount;
+    Material materials[256]; // Indexed by PackedVertex::material
+};
+
+struct SceneCacheMesh {
+    uint64_t vertexOffset, vertexCount;
+    uint64_t indexOffset, indexCount;
+    uint64_t drawRangeOffset, drawRangeCount;
+    AABB bounds;
+};
+
+class SceneCache {
+private:
+    const char *data = nullptr;
+    size_t size = 0;
+#ifdef _WIN32
+    vector<char> fileContents; // No mmap - the file is read instead
+#endif
+
+    const SceneCacheHeader &getHeader() const;
+
+    const SceneCacheMesh &getMeshEntry(size_t index) const;
+
+    bool isValid(uint64_t contentHash) const;
+
+public:
+    static const uint32_t VERSION = 2;
+    static const uint32_t MAX_MATERIALS = 256;
+
+    static bool write(const string &path, uint64_t contentHash, const vector<MeshView> &meshes,
+                      const vector<Material> &materials);
+
+    // Maps the file, fails if it is missing, truncated, from another version or for other content
+    bool open(const string &path, uint64_t contentHash);
+
+    size_t getMeshCount() const;
+
+    // Points into the mapping, valid until close()
+    MeshView getMesh(size_t index) const;
+
+    vector<Material> getMaterials() const;
+
+    size_t getSize() const;
+
+    void close();
+
+    ~SceneCache();
+};
+
+#endif //GC_SCENECACHE_H
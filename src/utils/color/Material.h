@@ -0,0 +1,18 @@
+#ifndef GC_MATERIAL_H
+#define GC_MATERIAL_H
+
+#include <glm/glm.hpp>
+
+using namespace glm;
+
+// Surface parameters shared by every vertex referencing the material
+struct Material {
+    vec3 color;
+    float shininess;
+
+    bool operator==(const Material &other) const {
+        return color == other.color && shininess == other.shininess;
+    }
+};
+
+#endif //GC_MATERIAL_H
@@ -0,0 +1,52 @@
+#include "AABB.h"
+
+AABB::AABB(vec3 min, vec3 max) : min(min), max(max) {
+}
+
+bool AABB::isEmpty() const {
+    return min.x > max.x || min.y > max.y || min.z > max.z;
+}
+
+vec3 AABB::getCenter() const {
+    return 0.5f * (min + max);
+}
+
+vec3 AABB::getExtent() const {
+    return 0.5f * (max - min);
+}
+
+float AABB::distanceTo(vec3 point) const {
+    return length(glm::max(glm::max(min - point, point - max), vec3(0.0f)));
+}
+
+void AABB::expand(vec3 point) {
+    min = glm::min(min, point);
+    max = glm::max(max, point);
+}
+
+void AABB::expand(const AABB &other) {
+    min = glm::min(min, other.min);
+    max = glm::max(max, other.max);
+}
+
+AABB AABB::transformed(float scale, float rotation, vec3 translation) const {
+    const auto rotationSin = sin(rotation);
+    const auto rotationCos = cos(rotation);
+
+    // Same rotation as the instance transform in shader.vert
+    const auto center = scale * getCenter();
+    const auto rotatedCenter = vec3(
+            rotationCos * center.x + rotationSin * center.z,
+            center.y,
+            -rotationSin * center.x + rotationCos * center.z
+    ) + translation;
+
+    const auto extent = scale * getExtent();
+    const auto rotatedExtent = vec3(
+            abs(rotationCos) * extent.x + abs(rotationSin) * extent.z,
+            extent.y,
+            abs(rotationSin) * extent.x + abs(rotationCos) * extent.z
+    );
+
+    return AABB(rotatedCenter - rotatedExtent, rotatedCenter + rotatedExtent);
+}
@@ -0,0 +1,34 @@
+#ifndef GC_AABB_H
+#define GC_AABB_H
+
+#include <glm/glm.hpp>
+#include <cfloat>
+
+using namespace glm;
+
+struct AABB {
+    vec3 min = vec3(FLT_MAX);
+    vec3 max = vec3(-FLT_MAX);
+
+    AABB() = default;
+
+    AABB(vec3 min, vec3 max);
+
+    bool isEmpty() const;
+
+    vec3 getCenter() const;
+
+    vec3 getExtent() const;
+
+    // 0 when the point is inside
+    float distanceTo(vec3 point) const;
+
+    void expand(vec3 point);
+
+    void expand(const AABB &other);
+
+    // Bounds of this box after uniform scale, rotation around Y (radians) and translation
+    AABB transformed(float scale, float rotation, vec3 translation) const;
+};
+
+#endif //GC_AABB_H
@@ -0,0 +1,138 @@
+#include "Bvh.h"
+#include <algorithm>
+
+void Bvh::build(const vector<AABB> &itemBounds) {
+    bounds = itemBounds;
+    nodes.clear();
+    items.resize(bounds.size());
+
+    vector<vec3> centroids(bounds.size());
+    for (auto i = 0; i < bounds.size(); i++) {
+        items[i] = i;
+        centroids[i] = bounds[i].getCenter();
+    }
+
+    if (!items.empty()) {
+        nodes.reserve(2 * items.size() / MAX_LEAF_ITEMS + 1);
+        buildNode(0, (unsigned) items.size(), centroids);
+    }
+}
+
+unsigned Bvh::buildNode(unsigned firstItem, unsigned itemCount, const vector<vec3> &centroids) {
+    const auto nodeIndex = (unsigned) nodes.size();
+    nodes.push_back(Node{AABB(), firstItem, itemCount, 0});
+
+    AABB nodeBounds, centroidBounds;
+    for (auto i = firstItem; i < firstItem + itemCount; i++) {
+        nodeBounds.expand(bounds[items[i]]);
+        centroidBounds.expand(centroids[items[i]]);
+    }
+    nodes[nodeIndex].bounds = nodeBounds;
+
+    if (itemCount <= MAX_LEAF_ITEMS) {
+        return nodeIndex;
+    }
+
+    // Split at the median along the longest axis of the centroids
+    const auto size = centroidBounds.max - centroidBounds.min;
+    auto axis = 0;
+    if (size.y > size[axis]) {
+        axis = 1;
+    }
+    if (size.z > size[axis]) {
+        axis = 2;
+    }
+
+    const auto begin = items.begin() + firstItem;
+    const auto middle = begin + itemCount / 2;
+    nth_element(begin, middle, begin + itemCount, [&](unsigned a, unsigned b) {
+        return centroids[a][axis] < centroids[b][axis];
+    });
+
+    const auto leftCount = itemCount / 2;
+    buildNode(firstItem, leftCount, centroids);
+    const auto rightChild = buildNode(firstItem + leftCount, itemCount - leftCount, centroids);
+
+    nodes[nodeIndex].itemCount = 0;
+    nodes[nodeIndex].rightChild = rightChild;
+    return nodeIndex;
+}
+
+size_t Bvh::getItemCount() const {
+    return items.size();
+}
+
+size_t Bvh::getNodeCount() const {
+    return nodes.size();
+}
+
+const AABB &Bvh::getBounds() const {
+    static const AABB EMPTY;
+    return nodes.empty() ? EMPTY : nodes[0].bounds;
+}
+
+const AABB &Bvh::getItemBounds(unsigned item) const {
+    return bounds[item];
+}
+
+void Bvh::appendItems(const Node &node, vector<unsigned> &visibleItems) const {
+    visibleItems.insert(visibleItems.end(), items.begin() + node.firstItem,
+                        items.begin() + node.firstItem + node.itemCount);
+}
+
+void Bvh::appendSubtree(unsigned nodeIndex, vector<unsigned> &visibleItems, CullingStats &stats) const {
+    // Fully inside the frustum - every item below is visible
+    const auto &node = nodes[nodeIndex];
+    stats.nodesVisited++;
+    if (node.itemCount > 0) {
+        appendItems(node, visibleItems);
+        return;
+    }
+
+    appendSubtree(nodeIndex + 1, visibleItems, stats);
+    appendSubtree(node.rightChild, visibleItems, stats);
+}
+
+CullingStats Bvh::cull(const Frustum &frustum, vector<unsigned> &visibleItems) const {
+    CullingStats stats;
+    if (nodes.empty()) {
+        return stats;
+    }
+
+    const auto visibleBefore = visibleItems.size();
+
+    // Explicit stack of (node, planes still to test)
+    vector<pair<unsigned, unsigned>> stack;
+    stack.reserve(64);
+    stack.emplace_back(0, Frustum::ALL_PLANES);
+    while (!stack.empty()) {
+        auto [nodeIndex, planeMask] = stack.back();
+        stack.pop_back();
+        stats.nodesVisited++;
+
+        const auto &node = nodes[nodeIndex];
+        const auto result = frustum.test(node.bounds, planeMask);
+        if (result == FrustumTest::OUTSIDE) {
+            continue;
+        }
+
+        if (result == FrustumTest::INSIDE) {
+            stats.nodesVisited--;
+            appendSubtree(nodeIndex, visibleItems, stats);
+        } else if (node.itemCount > 0) {
+            for (auto i = node.firstItem; i < node.firstItem + node.itemCount; i++) {
+                auto itemPlaneMask = planeMask;
+                if (frustum.test(bounds[items[i]], itemPlaneMask) != FrustumTest::OUTSIDE) {
+                    visibleItems.push_back(items[i]);
+                }
+            }
+        } else {
+            stack.emplace_back(node.rightChild, planeMask);
+            stack.emplace_back(nodeIndex + 1, planeMask);
+        }
+    }
+
+    stats.visibleCount = visibleItems.size() - visibleBefore;
+    stats.culledCount = items.size() - stats.visibleCount;
+    return stats;
+}
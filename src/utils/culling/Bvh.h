@@ -0,0 +1,56 @@
+#ifndef GC_BVH_H
+#define GC_BVH_H
+
+#include <vector>
+#include "AABB.h"
+#include "Frustum.h"
+
+using namespace std;
+
+struct CullingStats {
+    size_t visibleCount = 0;
+    size_t culledCount = 0;
+    size_t nodesVisited = 0;
+};
+
+// Bounding volume hierarchy over a fixed set of boxes, built top-down by splitting on the
+// median centroid of the longest axis. Items are referred to by their index in the build input.
+class Bvh {
+public:
+    void build(const vector<AABB> &itemBounds);
+
+    size_t getItemCount() const;
+
+    size_t getNodeCount() const;
+
+    const AABB &getBounds() const;
+
+    const AABB &getItemBounds(unsigned item) const;
+
+    // Appends the indices of the items intersecting the frustum
+    CullingStats cull(const Frustum &frustum, vector<unsigned> &visibleItems) const;
+
+private:
+    static const unsigned MAX_LEAF_ITEMS = 4;
+
+    struct Node {
+        AABB bounds;
+        // Leaves reference items[firstItem, firstItem + itemCount), inner nodes have their
+        // left child right after them and the right child at rightChild
+        unsigned firstItem;
+        unsigned itemCount;
+        unsigned rightChild;
+    };
+
+    vector<Node> nodes;
+    vector<unsigned> items;
+    vector<AABB> bounds;
+
+    unsigned buildNode(unsigned firstItem, unsigned itemCount, const vector<vec3> &centroids);
+
+    void appendItems(const Node &node, vector<unsigned> &visibleItems) const;
+
+    void appendSubtree(unsigned nodeIndex, vector<unsigned> &visibleItems, CullingStats &stats) const;
+};
+
+#endif //GC_BVH_H
@@ -0,0 +1,51 @@
+#include "Frustum.h"
+
+Frustum Frustum::fromMatrix(const mat4 &viewProjection) {
+    // glm matrices are column-major, row i is (m[0][i], m[1][i], m[2][i], m[3][i])
+    auto row = [&](int i) {
+        return vec4(viewProjection[0][i], viewProjection[1][i], viewProjection[2][i], viewProjection[3][i]);
+    };
+
+    Frustum frustum{};
+    frustum.planes[0] = row(3) + row(0); // Left
+    frustum.planes[1] = row(3) - row(0); // Right
+    frustum.planes[2] = row(3) + row(1); // Bottom
+    frustum.planes[3] = row(3) - row(1); // Top
+    frustum.planes[4] = row(3) + row(2); // Near
+    frustum.planes[5] = row(3) - row(2); // Far
+
+    for (auto &plane: frustum.planes) {
+        plane /= length(vec3(plane));
+    }
+
+    return frustum;
+}
+
+bool Frustum::isVisible(const AABB &box) const {
+    auto planeMask = ALL_PLANES;
+    return test(box, planeMask) != FrustumTest::OUTSIDE;
+}
+
+FrustumTest Frustum::test(const AABB &box, unsigned &planeMask) const {
+    const auto center = box.getCenter();
+    const auto extent = box.getExtent();
+
+    for (auto i = 0; i < PLANE_COUNT; i++) {
+        if (!(planeMask & (1u << i))) {
+            continue;
+        }
+
+        const auto normal = vec3(planes[i]);
+        const auto distance = dot(normal, center) + planes[i].w;
+        const auto radius = dot(abs(normal), extent);
+
+        if (distance < -radius) {
+            return FrustumTest::OUTSIDE;
+        }
+        if (distance > radius) {
+            planeMask &= ~(1u << i);
+        }
+    }
+
+    return planeMask == 0 ? FrustumTest::INSIDE : FrustumTest::INTERSECTS;
+}
@@ -0,0 +1,33 @@
+#ifndef GC_FRUSTUM_H
+#define GC_FRUSTUM_H
+
+#include <glm/glm.hpp>
+#include "AABB.h"
+
+using namespace glm;
+
+enum class FrustumTest {
+    OUTSIDE,
+    INTERSECTS,
+    INSIDE
+};
+
+class Frustum {
+public:
+    static const int PLANE_COUNT = 6;
+    static const unsigned ALL_PLANES = (1u << PLANE_COUNT) - 1;
+
+    // Planes of a combined projection * view matrix (Gribb-Hartmann), normals point inwards
+    static Frustum fromMatrix(const mat4 &viewProjection);
+
+    bool isVisible(const AABB &box) const;
+
+    // Only tests the planes set in planeMask and clears the bits of planes the box is fully inside of,
+    // so children of a box that passed a plane don't need to test it again
+    FrustumTest test(const AABB &box, unsigned &planeMask) const;
+
+private:
+    vec4 planes[PLANE_COUNT];
+};
+
+#endif //GC_FRUSTUM_H
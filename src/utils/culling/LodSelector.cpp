@@ -0,0 +1,38 @@
+#include "LodSelector.h"
+
+LodSelector::LodSelector(vector<float> thresholds, float hysteresis)
+        : thresholds(thresholds), hysteresis(hysteresis) {
+}
+
+size_t LodSelector::getLodCount() const {
+    return thresholds.size() + 1;
+}
+
+unsigned LodSelector::select(float projectedSize, unsigned currentLod) const {
+    auto lod = glm::min(currentLod, (unsigned) thresholds.size());
+
+    // Finer
+    while (lod > 0 && projectedSize >= thresholds[lod - 1] * (1.0f + hysteresis)) {
+        lod--;
+    }
+    // Coarser
+    while (lod < thresholds.size() && projectedSize < thresholds[lod] * (1.0f - hysteresis)) {
+        lod++;
+    }
+
+    return lod;
+}
+
+float LodSelector::projectedSize(const AABB &bounds, vec3 cameraPosition, float pixelsPerUnitAtUnitDistance) {
+    const auto radius = length(bounds.getExtent());
+    const auto distance = length(bounds.getCenter() - cameraPosition);
+    if (distance <= radius) {
+        return FLT_MAX;
+    }
+
+    return 2.0f * radius * pixelsPerUnitAtUnitDistance / distance;
+}
+
+float LodSelector::pixelsPerUnitAtUnitDistance(const mat4 &projection, float viewportHeight) {
+    return projection[1][1] * viewportHeight / 2.0f;
+}
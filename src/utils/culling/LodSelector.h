@@ -0,0 +1,35 @@
+#ifndef GC_LODSELECTOR_H
+#define GC_LODSELECTOR_H
+
+#include <glm/glm.hpp>
+#include <vector>
+#include "AABB.h"
+
+using namespace std;
+using namespace glm;
+
+// Picks a level of detail from the projected screen size of an object. thresholds[i] is the size, in
+// pixels, below which level i + 1 is used instead of level i. A level only changes once the size moves
+// past its threshold by the hysteresis fraction, so objects hovering around a threshold don't pop.
+class LodSelector {
+public:
+    LodSelector() = default;
+
+    LodSelector(vector<float> thresholds, float hysteresis);
+
+    size_t getLodCount() const;
+
+    unsigned select(float projectedSize, unsigned currentLod) const;
+
+    // Screen-space diameter in pixels of the bounding sphere of a box
+    static float projectedSize(const AABB &bounds, vec3 cameraPosition, float pixelsPerUnitAtUnitDistance);
+
+    // proj[1][1] * viewportHeight / 2 - converts size / distance into pixels
+    static float pixelsPerUnitAtUnitDistance(const mat4 &projection, float viewportHeight);
+
+private:
+    vector<float> thresholds;
+    float hysteresis = 0.0f;
+};
+
+#endif //GC_LODSELECTOR_H
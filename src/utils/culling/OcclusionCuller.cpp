@@ -0,0 +1,288 @@
+#include "OcclusionCuller.h"
+#include "../render/FrameConstants.h"
+#include <iostream>
+#include <algorithm>
+#include <cstring>
+
+bool OcclusionCuller::initialize(ProgramCache &programCache, const string &vertexShaderPath,
+                                 const string &fragShaderPath) {
+    program = programCache.loadProgram(vertexShaderPath.c_str(), fragShaderPath.c_str());
+    if (program == 0) {
+        cout << "ERROR::OCCLUSION::NO_VALID_PROGRAM" << endl;
+        return false;
+    }
+    FrameConstants::bindProgram(program);
+
+    glGenRenderbuffers(1, &depthRenderbuffer);
+    glBindRenderbuffer(GL_RENDERBUFFER, depthRenderbuffer);
+    glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH_COMPONENT32F, WIDTH, HEIGHT);
+    glBindRenderbuffer(GL_RENDERBUFFER, 0);
+
+    GLint boundFramebuffer = 0;
+    glGetIntegerv(GL_DRAW_FRAMEBUFFER_BINDING, &boundFramebuffer);
+    glGenFramebuffers(1, &framebuffer);
+    glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+    glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_RENDERBUFFER, depthRenderbuffer);
+    glDrawBuffer(GL_NONE);
+    glReadBuffer(GL_NONE);
+    const auto status = glCheckFramebufferStatus(GL_FRAMEBUFFER);
+    glBindFramebuffer(GL_FRAMEBUFFER, boundFramebuffer);
+    if (status != GL_FRAMEBUFFER_COMPLETE) {
+        cout << "ERROR::OCCLUSION::FRAMEBUFFER_INCOMPLETE " << status << endl;
+        return false;
+    }
+
+    for (auto &readback: readbacks) {
+        glGenBuffers(1, &readback.pixelBuffer);
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, readback.pixelBuffer);
+        glBufferData(GL_PIXEL_PACK_BUFFER, WIDTH * HEIGHT * sizeof(GLfloat), nullptr, GL_STREAM_READ);
+    }
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+    // Each level halves the previous one, rounding up so every texel stays covered, down to a single texel
+    auto width = WIDTH, height = HEIGHT;
+    while (true) {
+        levels.push_back(Level{width, height, vector<float>(width * height, 1.0f)});
+        if (width == 1 && height == 1) {
+            break;
+        }
+        width = (width + 1) / 2;
+        height = (height + 1) / 2;
+    }
+    readbackDepths.assign(WIDTH * HEIGHT, 1.0f);
+    return true;
+}
+
+GLuint OcclusionCuller::getProgram() const {
+    return program;
+}
+
+bool OcclusionCuller::beginOccluderPass(const mat4 &viewProjection) {
+    auto &readback = readbacks[nextSlot];
+    if (readback.fence != nullptr) {
+        return false;
+    }
+    readback.viewProjection = viewProjection;
+    activeSlot = nextSlot;
+
+    glGetIntegerv(GL_DRAW_FRAMEBUFFER_BINDING, &previousFramebuffer);
+    glGetIntegerv(GL_VIEWPORT, previousViewport);
+    glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+    glViewport(0, 0, WIDTH, HEIGHT);
+    glClear(GL_DEPTH_BUFFER_BIT);
+    glUseProgram(program);
+    return true;
+}
+
+void OcclusionCuller::endOccluderPass() {
+    auto &readback = readbacks[activeSlot];
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, readback.pixelBuffer);
+    glReadPixels(0, 0, WIDTH, HEIGHT, GL_DEPTH_COMPONENT, GL_FLOAT, nullptr);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+    readback.fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+
+    glBindFramebuffer(GL_FRAMEBUFFER, previousFramebuffer);
+    glViewport(previousViewport[0], previousViewport[1], previousViewport[2], previousViewport[3]);
+    nextSlot = (activeSlot + 1) % READBACK_SLOTS;
+    activeSlot = -1;
+}
+
+void OcclusionCuller::update(const mat4 &viewProjection) {
+    // Oldest first, so the newest finished pass is the one kept
+    auto hasNewReadback = false;
+    for (auto i = 0; i < READBACK_SLOTS; i++) {
+        auto &readback = readbacks[(nextSlot + i) % READBACK_SLOTS];
+        if (readback.fence == nullptr) {
+            continue;
+        }
+
+        const auto result = glClientWaitSync(readback.fence, 0, 0);
+        if (result != GL_ALREADY_SIGNALED && result != GL_CONDITION_SATISFIED) {
+            break;
+        }
+        glDeleteSync(readback.fence);
+        readback.fence = nullptr;
+
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, readback.pixelBuffer);
+        const auto *depths = (const GLfloat *) glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0,
+                                                                 WIDTH * HEIGHT * sizeof(GLfloat), GL_MAP_READ_BIT);
+        if (depths != nullptr) {
+            memcpy(readbackDepths.data(), depths, WIDTH * HEIGHT * sizeof(GLfloat));
+            readbackViewProjection = readback.viewProjection;
+            hasReadback = true;
+            hasNewReadback = true;
+            glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+        }
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+    }
+
+    // The pyramid only changes with the depths or the camera
+    if (hasReadback &&
+        (hasNewReadback || memcmp(&viewProjection, &pyramidViewProjection, sizeof(mat4)) != 0)) {
+        pyramidViewProjection = viewProjection;
+        reproject();
+        buildPyramid();
+    }
+}
+
+void OcclusionCuller::reproject() {
+    // Scattered with the farthest sample winning, -1 marks texels nothing landed on
+    auto &scattered = scatteredDepths;
+    if (memcmp(&readbackViewProjection, &pyramidViewProjection, sizeof(mat4)) == 0) {
+        scattered = readbackDepths;
+    } else {
+        scattered.assign(WIDTH * HEIGHT, -1.0f);
+        // From the readback's clip space to the pyramid's, a texel's column, row & depth each add their own term
+        const auto reprojection = pyramidViewProjection * inverse(readbackViewProjection);
+        for (auto y = 0; y < HEIGHT; y++) {
+            const auto rowClip = reprojection[1] * (((float) y + 0.5f) / (float) HEIGHT * 2.0f - 1.0f) +
+                                 reprojection[3];
+            for (auto x = 0; x < WIDTH; x++) {
+                const auto depth = readbackDepths[y * WIDTH + x];
+                if (depth >= 1.0f) {
+                    continue;
+                }
+
+                const auto clip = rowClip + reprojection[0] * (((float) x + 0.5f) / (float) WIDTH * 2.0f - 1.0f) +
+                                  reprojection[2] * (depth * 2.0f - 1.0f);
+                if (clip.w <= 0.0f) {
+                    continue;
+                }
+                const auto ndc = vec3(clip) / clip.w;
+                const auto targetX = (int) floor((ndc.x * 0.5f + 0.5f) * (float) WIDTH);
+                const auto targetY = (int) floor((ndc.y * 0.5f + 0.5f) * (float) HEIGHT);
+                if (targetX < 0 || targetX >= WIDTH || targetY < 0 || targetY >= HEIGHT || ndc.z < -1.0f) {
+                    continue;
+                }
+
+                auto &texel = scattered[targetY * WIDTH + targetX];
+                texel = std::max(texel, std::min(ndc.z * 0.5f + 0.5f, 1.0f));
+            }
+        }
+    }
+
+    // A texel only counts as covered when its neighbours are too - the occluders were rasterized at a low
+    // resolution, so edge texels can be partly open (and holes from the scatter are treated the same way). The 3x3
+    // max is done as a row pass into the level, then a column pass back
+    auto &target = levels[0].depths;
+    for (auto &depth: scattered) {
+        if (depth < 0.0f) {
+            depth = 1.0f;
+        }
+    }
+    for (auto y = 0; y < HEIGHT; y++) {
+        const auto *row = &scattered[y * WIDTH];
+        auto *targetRow = &target[y * WIDTH];
+        for (auto x = 0; x < WIDTH; x++) {
+            targetRow[x] = std::max({row[std::max(x - 1, 0)], row[x], row[std::min(x + 1, WIDTH - 1)]});
+        }
+    }
+    for (auto y = 0; y < HEIGHT; y++) {
+        const auto *above = &target[std::max(y - 1, 0) * WIDTH];
+        const auto *row = &target[y * WIDTH];
+        const auto *below = &target[std::min(y + 1, HEIGHT - 1) * WIDTH];
+        auto *scatteredRow = &scattered[y * WIDTH];
+        for (auto x = 0; x < WIDTH; x++) {
+            scatteredRow[x] = std::max({above[x], row[x], below[x]});
+        }
+    }
+    target.swap(scattered);
+}
+
+void OcclusionCuller::buildPyramid() {
+    for (auto level = 1; level < levels.size(); level++) {
+        const auto &source = levels[level - 1];
+        auto &target = levels[level];
+        for (auto y = 0; y < target.height; y++) {
+            for (auto x = 0; x < target.width; x++) {
+                target.depths[y * target.width + x] = getMaxDepth(
+                        level - 1, x * 2, y * 2,
+                        std::min(x * 2 + 1, source.width - 1), std::min(y * 2 + 1, source.height - 1)
+                );
+            }
+        }
+    }
+}
+
+float OcclusionCuller::getMaxDepth(int level, int minX, int minY, int maxX, int maxY) const {
+    const auto &source = levels[level];
+    auto depth = 0.0f;
+    for (auto y = minY; y <= maxY; y++) {
+        for (auto x = minX; x <= maxX; x++) {
+            depth = std::max(depth, source.depths[y * source.width + x]);
+        }
+    }
+    return depth;
+}
+
+bool OcclusionCuller::isVisible(const AABB &bounds) {
+    stats.testedCount++;
+    if (!hasReadback) {
+        stats.fallbackCount++;
+        return true;
+    }
+
+    auto ndcMin = vec3(FLT_MAX), ndcMax = vec3(-FLT_MAX);
+    for (auto corner = 0; corner < 8; corner++) {
+        const auto point = vec3(
+                corner & 1 ? bounds.max.x : bounds.min.x,
+                corner & 2 ? bounds.max.y : bounds.min.y,
+                corner & 4 ? bounds.max.z : bounds.min.z
+        );
+        const auto clip = pyramidViewProjection * vec4(point, 1.0f);
+        // Reaches behind the camera, its projection isn't bounded
+        if (clip.w <= 0.0f) {
+            return true;
+        }
+        const auto ndc = vec3(clip) / clip.w;
+        ndcMin = glm::min(ndcMin, ndc);
+        ndcMax = glm::max(ndcMax, ndc);
+    }
+    if (ndcMin.z < -1.0f) {
+        return true;
+    }
+
+    // Texels covered at level 0, then the level where that's at most MAX_TEST_TEXELS across
+    const auto minX = glm::clamp((int) floor((ndcMin.x * 0.5f + 0.5f) * (float) WIDTH), 0, WIDTH - 1);
+    const auto maxX = glm::clamp((int) floor((ndcMax.x * 0.5f + 0.5f) * (float) WIDTH), 0, WIDTH - 1);
+    const auto minY = glm::clamp((int) floor((ndcMin.y * 0.5f + 0.5f) * (float) HEIGHT), 0, HEIGHT - 1);
+    const auto maxY = glm::clamp((int) floor((ndcMax.y * 0.5f + 0.5f) * (float) HEIGHT), 0, HEIGHT - 1);
+    auto level = 0;
+    while (level + 1 < levels.size() &&
+           ((maxX >> level) - (minX >> level) >= MAX_TEST_TEXELS ||
+            (maxY >> level) - (minY >> level) >= MAX_TEST_TEXELS)) {
+        level++;
+    }
+
+    const auto nearestDepth = ndcMin.z * 0.5f + 0.5f;
+    if (nearestDepth <= getMaxDepth(level, minX >> level, minY >> level, maxX >> level, maxY >> level)) {
+        return true;
+    }
+    stats.occludedCount++;
+    return false;
+}
+
+void OcclusionCuller::resetStats() {
+    stats = OcclusionStats();
+}
+
+const OcclusionStats &OcclusionCuller::getStats() const {
+    return stats;
+}
+
+bool OcclusionCuller::hasPyramid() const {
+    return hasReadback;
+}
+
+void OcclusionCuller::cleanUp() {
+    for (auto &readback: readbacks) {
+        if (readback.fence != nullptr) {
+            glDeleteSync(readback.fence);
+            readback.fence = nullptr;
+        }
+        glDeleteBuffers(1, &readback.pixelBuffer);
+    }
+    glDeleteFramebuffers(1, &framebuffer);
+    glDeleteRenderbuffers(1, &depthRenderbuffer);
+    glDeleteProgram(program);
+}
@@ -0,0 +1,99 @@
+#ifndef GC_OCCLUSIONCULLER_H
+#define GC_OCCLUSIONCULLER_H
+
+#include <GL/glew.h>
+#include <glm/glm.hpp>
+#include <string>
+#include <vector>
+#include "AABB.h"
+#include "../cache/ProgramCache.h"
+
+using namespace std;
+using namespace glm;
+
+struct OcclusionStats {
+    size_t testedCount = 0;
+    size_t occludedCount = 0;
+    size_t fallbackCount = 0; // Tested without a finished pyramid, so kept
+};
+
+// Hierarchical Z occlusion culling. The large occluders are drawn depth-only into a small framebuffer and read back
+// asynchronously through pixel buffers, a pass is never waited for. The depths of the last finished pass are
+// reprojected to the current camera, eroded by a texel and reduced into a max-depth mip pyramid - texels nothing
+// lands on stay at the far plane, so what the old pass didn't see is kept. Until a pass has finished everything is
+// visible.
+class OcclusionCuller {
+public:
+    static const int WIDTH = 320;
+    static const int HEIGHT = 180;
+
+    bool initialize(ProgramCache &programCache, const string &vertexShaderPath, const string &fragShaderPath);
+
+    GLuint getProgram() const;
+
+    // Binds the depth framebuffer & program - returns false when every readback slot is still in flight, in which
+    // case the occluders aren't drawn this frame
+    bool beginOccluderPass(const mat4 &viewProjection);
+
+    // Starts the readback and restores the previous framebuffer & viewport
+    void endOccluderPass();
+
+    // Takes the newest finished readback, if any, and rebuilds the pyramid for the camera boxes are tested with
+    void update(const mat4 &viewProjection);
+
+    // False only when the box is certainly behind the occluders
+    bool isVisible(const AABB &bounds);
+
+    void resetStats();
+
+    const OcclusionStats &getStats() const;
+
+    bool hasPyramid() const;
+
+    void cleanUp();
+
+private:
+    static const int READBACK_SLOTS = 2;
+    // Boxes covering up to this many texels of the chosen level are tested, larger ones go a level up
+    static const int MAX_TEST_TEXELS = 2;
+
+    struct Readback {
+        GLuint pixelBuffer = 0;
+        GLsync fence = nullptr;
+        mat4 viewProjection;
+    };
+
+    struct Level {
+        int width;
+        int height;
+        vector<float> depths;
+    };
+
+    GLuint program = 0;
+    GLuint framebuffer = 0;
+    GLuint depthRenderbuffer = 0;
+    Readback readbacks[READBACK_SLOTS];
+    int nextSlot = 0;
+    int activeSlot = -1;
+    GLint previousFramebuffer = 0;
+    GLint previousViewport[4] = {};
+
+    // Depths of the last finished pass, with the camera they were drawn with
+    vector<float> readbackDepths;
+    mat4 readbackViewProjection;
+    bool hasReadback = false;
+    vector<float> scatteredDepths;
+
+    vector<Level> levels;
+    mat4 pyramidViewProjection;
+    OcclusionStats stats;
+
+    // Level 0 from the read back depths, as seen from the pyramid camera
+    void reproject();
+
+    void buildPyramid();
+
+    float getMaxDepth(int level, int minX, int minY, int maxX, int maxY) const;
+};
+
+#endif //GC_OCCLUSIONCULLER_H
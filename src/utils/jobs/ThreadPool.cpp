@@ -0,0 +1,137 @@
+#include "ThreadPool.h"
+#include <algorithm>
+
+namespace {
+    // Index of the queue owned by the current thread, 0 outside the pool
+    thread_local size_t currentQueueIndex = 0;
+    thread_local const void *currentPool = nullptr;
+}
+
+void ThreadPool::initialize(unsigned threadCount) {
+    if (threadCount == 0) {
+        threadCount = std::max(1u, thread::hardware_concurrency());
+    }
+
+    isStopping = false;
+    for (auto i = 0; i < threadCount; i++) {
+        queues.push_back(make_unique<WorkerQueue>());
+    }
+    for (auto i = 1; i < threadCount; i++) {
+        workers.emplace_back(&ThreadPool::workerLoop, this, (size_t) i);
+    }
+}
+
+size_t ThreadPool::getCurrentQueueIndex() const {
+    return currentPool == this ? currentQueueIndex : 0;
+}
+
+void ThreadPool::submit(JobCounter &counter, function<void()> job) {
+    counter.pending.fetch_add(1);
+
+    auto &queue = *queues[getCurrentQueueIndex()];
+    {
+        lock_guard<mutex> guard(queue.lock);
+        queue.jobs.push_back(Job{std::move(job), &counter});
+    }
+    queuedJobCount.fetch_add(1);
+
+    // Taking the lock orders the notification after a worker's check of the job count
+    {
+        lock_guard<mutex> guard(sleepLock);
+    }
+    wakeUp.notify_one();
+}
+
+bool ThreadPool::tryRunJob(size_t queueIndex) {
+    Job job;
+    auto isFound = false;
+
+    // Own queue first (most recently pushed, still warm in cache), then steal the oldest job of another queue
+    {
+        auto &queue = *queues[queueIndex];
+        lock_guard<mutex> guard(queue.lock);
+        if (!queue.jobs.empty()) {
+            job = std::move(queue.jobs.back());
+            queue.jobs.pop_back();
+            isFound = true;
+        }
+    }
+    for (auto offset = 1; offset < queues.size() && !isFound; offset++) {
+        auto &queue = *queues[(queueIndex + offset) % queues.size()];
+        lock_guard<mutex> guard(queue.lock);
+        if (!queue.jobs.empty()) {
+            job = std::move(queue.jobs.front());
+            queue.jobs.pop_front();
+            isFound = true;
+        }
+    }
+
+    if (!isFound) {
+        return false;
+    }
+
+    queuedJobCount.fetch_sub(1);
+    job.run();
+    job.counter->pending.fetch_sub(1);
+    return true;
+}
+
+void ThreadPool::workerLoop(size_t queueIndex) {
+    currentQueueIndex = queueIndex;
+    currentPool = this;
+
+    while (!isStopping) {
+        if (tryRunJob(queueIndex)) {
+            continue;
+        }
+
+        unique_lock<mutex> guard(sleepLock);
+        wakeUp.wait(guard, [this] {
+            return isStopping || queuedJobCount > 0;
+        });
+    }
+}
+
+void ThreadPool::wait(JobCounter &counter) {
+    const auto queueIndex = getCurrentQueueIndex();
+    while (counter.pending > 0) {
+        if (!tryRunJob(queueIndex)) {
+            this_thread::yield();
+        }
+    }
+}
+
+void ThreadPool::parallelFor(size_t count, const function<void(size_t begin, size_t end)> &body, size_t chunkSize) {
+    if (count <= chunkSize || queues.size() <= 1) {
+        if (count > 0) {
+            body(0, count);
+        }
+        return;
+    }
+
+    JobCounter counter;
+    for (size_t begin = 0; begin < count; begin += chunkSize) {
+        const auto end = std::min(begin + chunkSize, count);
+        submit(counter, [&body, begin, end] {
+            body(begin, end);
+        });
+    }
+    wait(counter);
+}
+
+unsigned ThreadPool::getThreadCount() const {
+    return (unsigned) queues.size();
+}
+
+void ThreadPool::cleanUp() {
+    {
+        lock_guard<mutex> guard(sleepLock);
+        isStopping = true;
+    }
+    wakeUp.notify_all();
+    for (auto &worker: workers) {
+        worker.join();
+    }
+    workers.clear();
+    queues.clear();
+}
@@ -0,0 +1,69 @@
+#ifndef GC_THREADPOOL_H
+#define GC_THREADPOOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace std;
+
+// Counts the unfinished jobs of a batch, see ThreadPool::wait
+struct JobCounter {
+    atomic<size_t> pending{0};
+};
+
+// Work-stealing pool - every worker pops from the back of its own queue and steals from the front of the others'.
+// The thread that waits on a batch runs jobs too, so with a thread count of 1 everything runs on the caller.
+class ThreadPool {
+private:
+    struct Job {
+        function<void()> run;
+        JobCounter *counter;
+    };
+
+    struct WorkerQueue {
+        mutex lock;
+        deque<Job> jobs;
+    };
+
+    // Queue 0 takes the jobs submitted from outside the pool, queue i + 1 belongs to worker i
+    vector<unique_ptr<WorkerQueue>> queues;
+    vector<thread> workers;
+    atomic<size_t> queuedJobCount{0};
+    atomic<bool> isStopping{false};
+    mutex sleepLock;
+    condition_variable wakeUp;
+
+    void workerLoop(size_t queueIndex);
+
+    bool tryRunJob(size_t queueIndex);
+
+    size_t getCurrentQueueIndex() const;
+
+public:
+    // Used for parallelFor, so small loops run inline as a single chunk
+    static const size_t DEFAULT_CHUNK_SIZE = 4096;
+
+    // Total threads including the calling one; 0 means one per hardware thread
+    void initialize(unsigned threadCount = 0);
+
+    void submit(JobCounter &counter, function<void()> job);
+
+    // Runs jobs until every job of the batch is done
+    void wait(JobCounter &counter);
+
+    // Splits [0, count) in chunks and waits for all of them
+    void parallelFor(size_t count, const function<void(size_t begin, size_t end)> &body,
+                     size_t chunkSize = DEFAULT_CHUNK_SIZE);
+
+    unsigned getThreadCount() const;
+
+    void cleanUp();
+};
+
+#endif //GC_THREADPOOL_H
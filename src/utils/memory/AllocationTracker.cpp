@@ -0,0 +1,126 @@
+#include "AllocationTracker.h"
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/resource.h>
+#endif
+
+namespace {
+    atomic<size_t> allocationCount(0);
+    atomic<size_t> bytesAllocated(0);
+
+    void *trackedAllocate(size_t size) {
+        allocationCount.fetch_add(1, memory_order_relaxed);
+        bytesAllocated.fetch_add(size, memory_order_relaxed);
+
+        auto *pointer = malloc(size == 0 ? 1 : size);
+        if (pointer == nullptr) {
+            throw bad_alloc();
+        }
+        return pointer;
+    }
+
+    void *trackedAllocateAligned(size_t size, align_val_t alignment) {
+        allocationCount.fetch_add(1, memory_order_relaxed);
+        bytesAllocated.fetch_add(size, memory_order_relaxed);
+
+        // aligned_alloc wants a multiple of the alignment
+        const auto alignmentBytes = static_cast<size_t>(alignment);
+        const auto alignedSize = ((size == 0 ? 1 : size) + alignmentBytes - 1) / alignmentBytes * alignmentBytes;
+#ifdef _WIN32
+        auto *pointer = _aligned_malloc(alignedSize, alignmentBytes);
+#else
+        auto *pointer = aligned_alloc(alignmentBytes, alignedSize);
+#endif
+        if (pointer == nullptr) {
+            throw bad_alloc();
+        }
+        return pointer;
+    }
+
+    void freeAligned(void *pointer) {
+#ifdef _WIN32
+        _aligned_free(pointer);
+#else
+        free(pointer);
+#endif
+    }
+}
+
+void *operator new(size_t size) {
+    return trackedAllocate(size);
+}
+
+void *operator new[](size_t size) {
+    return trackedAllocate(size);
+}
+
+void operator delete(void *pointer) noexcept {
+    free(pointer);
+}
+
+void operator delete[](void *pointer) noexcept {
+    free(pointer);
+}
+
+void operator delete(void *pointer, size_t) noexcept {
+    free(pointer);
+}
+
+void operator delete[](void *pointer, size_t) noexcept {
+    free(pointer);
+}
+
+// pmr::new_delete_resource goes through the aligned versions
+void *operator new(size_t size, align_val_t alignment) {
+    return trackedAllocateAligned(size, alignment);
+}
+
+void *operator new[](size_t size, align_val_t alignment) {
+    return trackedAllocateAligned(size, alignment);
+}
+
+void operator delete(void *pointer, align_val_t) noexcept {
+    freeAligned(pointer);
+}
+
+void operator delete[](void *pointer, align_val_t) noexcept {
+    freeAligned(pointer);
+}
+
+void operator delete(void *pointer, size_t, align_val_t) noexcept {
+    freeAligned(pointer);
+}
+
+void operator delete[](void *pointer, size_t, align_val_t) noexcept {
+    freeAligned(pointer);
+}
+
+AllocationSnapshot AllocationTracker::snapshot() {
+    return AllocationSnapshot{allocationCount.load(memory_order_relaxed), bytesAllocated.load(memory_order_relaxed)};
+}
+
+size_t AllocationTracker::getPeakRss() {
+#if defined(__unix__) || defined(__APPLE__)
+    rusage usage{};
+    if (getrusage(RUSAGE_SELF, &usage) != 0) {
+        return 0;
+    }
+#if defined(__APPLE__)
+    return (size_t) usage.ru_maxrss;
+#else
+    return (size_t) usage.ru_maxrss * 1024;
+#endif
+#else
+    return 0;
+#endif
+}
+
+void AllocationTracker::report(ostream &out, const string &label, const AllocationSnapshot &since) {
+    const auto now = snapshot();
+    out << label << ": " << now.allocationCount - since.allocationCount << " allocations, "
+        << (now.bytesAllocated - since.bytesAllocated) / 1024 << " KB, peak RSS "
+        << getPeakRss() / (1024 * 1024) << " MB" << endl;
+}
@@ -0,0 +1,27 @@
+#ifndef GC_ALLOCATIONTRACKER_H
+#define GC_ALLOCATIONTRACKER_H
+
+#include <cstddef>
+#include <iostream>
+#include <string>
+
+using namespace std;
+
+struct AllocationSnapshot {
+    size_t allocationCount = 0;
+    size_t bytesAllocated = 0;
+};
+
+// Counts every global operator new (the operators are replaced in AllocationTracker.cpp)
+class AllocationTracker {
+public:
+    static AllocationSnapshot snapshot();
+
+    // Peak resident set size of the process in bytes, 0 if unavailable
+    static size_t getPeakRss();
+
+    // Allocations made since the given snapshot
+    static void report(ostream &out, const string &label, const AllocationSnapshot &since);
+};
+
+#endif //GC_ALLOCATIONTRACKER_H
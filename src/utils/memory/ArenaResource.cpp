@@ -0,0 +1,82 @@
+#include "ArenaResource.h"
+#include <new>
+#include <algorithm>
+#include <cstdint>
+
+ArenaResource::ArenaResource(size_t initialBlockSize)
+        : initialBlockSize(initialBlockSize), nextBlockSize(initialBlockSize) {
+}
+
+ArenaResource::~ArenaResource() {
+    release();
+}
+
+void ArenaResource::addBlock(size_t minimumSize) {
+    // Blocks double in size, so a growing arena needs few of them
+    const auto size = std::max(nextBlockSize, minimumSize + sizeof(Block) + alignof(max_align_t));
+    auto *block = static_cast<Block *>(::operator new(size));
+    block->previous = currentBlock;
+    block->size = size;
+    currentBlock = block;
+    cursor = reinterpret_cast<char *>(block) + sizeof(Block);
+    end = reinterpret_cast<char *>(block) + size;
+
+    nextBlockSize = size * 2;
+    blockCount++;
+    capacity += size;
+}
+
+void *ArenaResource::do_allocate(size_t bytes, size_t alignment) {
+    auto address = reinterpret_cast<uintptr_t>(cursor);
+    auto aligned = (address + alignment - 1) & ~(uintptr_t) (alignment - 1);
+    if (currentBlock == nullptr || aligned + bytes > reinterpret_cast<uintptr_t>(end)) {
+        addBlock(bytes + alignment);
+        address = reinterpret_cast<uintptr_t>(cursor);
+        aligned = (address + alignment - 1) & ~(uintptr_t) (alignment - 1);
+    }
+
+    cursor = reinterpret_cast<char *>(aligned + bytes);
+    allocationCount++;
+    bytesAllocated += bytes;
+    return reinterpret_cast<void *>(aligned);
+}
+
+void ArenaResource::do_deallocate(void *pointer, size_t bytes, size_t) {
+    // Only the latest allocation can be given back, e.g. a vector that grew right away
+    if (static_cast<char *>(pointer) + bytes == cursor) {
+        cursor = static_cast<char *>(pointer);
+    }
+}
+
+bool ArenaResource::do_is_equal(const pmr::memory_resource &other) const noexcept {
+    return this == &other;
+}
+
+void ArenaResource::release() {
+    while (currentBlock != nullptr) {
+        auto *previous = currentBlock->previous;
+        ::operator delete(currentBlock);
+        currentBlock = previous;
+    }
+    cursor = nullptr;
+    end = nullptr;
+    nextBlockSize = initialBlockSize;
+    blockCount = 0;
+    capacity = 0;
+}
+
+size_t ArenaResource::getAllocationCount() const {
+    return allocationCount;
+}
+
+size_t ArenaResource::getBytesAllocated() const {
+    return bytesAllocated;
+}
+
+size_t ArenaResource::getBlockCount() const {
+    return blockCount;
+}
+
+size_t ArenaResource::getCapacity() const {
+    return capacity;
+}
@@ -0,0 +1,63 @@
+#ifndef GC_ARENARESOURCE_H
+#define GC_ARENARESOURCE_H
+
+#include <memory_resource>
+#include <cstddef>
+
+using namespace std;
+
+// Bump allocator for short-lived data (scene construction). Deallocation is a no-op except for the most recent
+// allocation, everything is freed at once by release().
+class ArenaResource : public pmr::memory_resource {
+private:
+    struct Block {
+        Block *previous;
+        size_t size;
+    };
+
+    Block *currentBlock = nullptr;
+    char *cursor = nullptr;
+    char *end = nullptr;
+    size_t initialBlockSize;
+    size_t nextBlockSize;
+
+    size_t allocationCount = 0;
+    size_t bytesAllocated = 0;
+    size_t blockCount = 0;
+    size_t capacity = 0;
+
+    void addBlock(size_t minimumSize);
+
+protected:
+    void *do_allocate(size_t bytes, size_t alignment) override;
+
+    void do_deallocate(void *pointer, size_t bytes, size_t alignment) override;
+
+    bool do_is_equal(const pmr::memory_resource &other) const noexcept override;
+
+public:
+    static const size_t INITIAL_BLOCK_SIZE = 64 * 1024;
+
+    explicit ArenaResource(size_t initialBlockSize = INITIAL_BLOCK_SIZE);
+
+    ArenaResource(const ArenaResource &) = delete;
+
+    ArenaResource &operator=(const ArenaResource &) = delete;
+
+    ~ArenaResource() override;
+
+    // Frees every block; anything allocated from the arena must no longer be used
+    void release();
+
+    // Totals over the lifetime of the arena
+    size_t getAllocationCount() const;
+
+    size_t getBytesAllocated() const;
+
+    // Blocks currently held
+    size_t getBlockCount() const;
+
+    size_t getCapacity() const;
+};
+
+#endif //GC_ARENARESOURCE_H
@@ -0,0 +1,89 @@
+#include "MeshBuilder.h"
+
+MeshBuilder::MeshBuilder(pmr::memory_resource *resource) : resource(resource), mesh(resource) {
+}
+
+void MeshBuilder::trackGrowth(size_t previousVertexCapacity, size_t previousIndexCapacity,
+                              size_t previousVertexCount, size_t previousIndexCount) {
+    if (mesh.vertices.capacity() != previousVertexCapacity) {
+        stats.allocations++;
+        stats.copiedElements += previousVertexCount;
+    }
+    if (mesh.indices.capacity() != previousIndexCapacity) {
+        stats.allocations++;
+        stats.copiedElements += previousIndexCount;
+    }
+}
+
+void MeshBuilder::reserve(MeshSize size) {
+    const auto vertexCapacity = mesh.vertices.capacity();
+    const auto indexCapacity = mesh.indices.capacity();
+    mesh.vertices.reserve(mesh.vertices.size() + size.vertexCount);
+    mesh.indices.reserve(mesh.indices.size() + size.indexCount);
+    trackGrowth(vertexCapacity, indexCapacity, mesh.vertices.size(), mesh.indices.size());
+}
+
+GLuint MeshBuilder::getBaseVertex() const {
+    return (GLuint) mesh.vertices.size();
+}
+
+PackedVertex *MeshBuilder::appendVertices(size_t count) {
+    const auto vertexCapacity = mesh.vertices.capacity();
+    const auto vertexCount = mesh.vertices.size();
+    mesh.vertices.resize(vertexCount + count);
+    trackGrowth(vertexCapacity, mesh.indices.capacity(), vertexCount, mesh.indices.size());
+
+    return mesh.vertices.data() + vertexCount;
+}
+
+GLuint *MeshBuilder::appendIndices(size_t count) {
+    const auto indexCapacity = mesh.indices.capacity();
+    const auto indexCount = mesh.indices.size();
+    mesh.indices.resize(indexCount + count);
+    trackGrowth(mesh.vertices.capacity(), indexCapacity, mesh.vertices.size(), indexCount);
+
+    return mesh.indices.data() + indexCount;
+}
+
+void MeshBuilder::beginRange() {
+    rangeIndexOffset = (GLuint) mesh.indices.size();
+}
+
+MeshRegion MeshBuilder::appendRegion(MeshSize size) {
+    const auto baseVertex = getBaseVertex();
+    auto *vertices = appendVertices(size.vertexCount);
+    auto *indices = appendIndices(size.indexCount);
+    return MeshRegion{vertices, indices, baseVertex};
+}
+
+void MeshBuilder::endRange() {
+    mesh.drawRanges.push_back(
+            DrawRange{rangeIndexOffset, (GLsizei) (mesh.indices.size() - rangeIndexOffset), 0, AABB()});
+    rangeIndexOffset = (GLuint) mesh.indices.size();
+}
+
+Mesh MeshBuilder::build() {
+    for (auto &drawRange: mesh.drawRanges) {
+        for (auto i = drawRange.indexOffset; i < drawRange.indexOffset + drawRange.indexCount; i++) {
+            drawRange.bounds.expand(mesh.vertices[mesh.indices[i]].position);
+        }
+        mesh.bounds.expand(drawRange.bounds);
+    }
+
+    Mesh builtMesh = std::move(mesh);
+    mesh = Mesh(resource);
+    rangeIndexOffset = 0;
+    return builtMesh;
+}
+
+MeshSize MeshBuilder::getSize() const {
+    return MeshSize{mesh.vertices.size(), mesh.indices.size()};
+}
+
+const MeshBuilderStats &MeshBuilder::getStats() const {
+    return stats;
+}
+
+pmr::memory_resource *MeshBuilder::getResource() const {
+    return resource;
+}
@@ -0,0 +1,118 @@
+#ifndef GC_MESHBUILDER_H
+#define GC_MESHBUILDER_H
+
+#include <GL/glew.h>
+#include <vector>
+#include <memory_resource>
+#include "../render/VertexFormat.h"
+#include "../render/DrawTable.h"
+
+using namespace std;
+
+struct MeshSize {
+    size_t vertexCount = 0;
+    size_t indexCount = 0;
+
+    MeshSize operator+(const MeshSize &other) const {
+        return MeshSize{vertexCount + other.vertexCount, indexCount + other.indexCount};
+    }
+};
+
+// Read-only view of a mesh's arrays, wherever they live (a Mesh, a memory-mapped file...)
+struct MeshView {
+    const PackedVertex *vertices = nullptr;
+    size_t vertexCount = 0;
+    const GLuint *indices = nullptr;
+    size_t indexCount = 0;
+    vector<DrawRange> drawRanges;
+    AABB bounds;
+};
+
+// Vertices & indices in their final, contiguous form. Indices are absolute, so every range has a base vertex of 0.
+// Move-only, so a mesh can't be copied on its way to the GPU by accident. The vertices & indices live in the given
+// memory resource, usually the scene construction arena.
+struct Mesh {
+    pmr::vector<PackedVertex> vertices;
+    pmr::vector<GLuint> indices;
+    vector<DrawRange> drawRanges;
+    AABB bounds;
+
+    explicit Mesh(pmr::memory_resource *resource = pmr::get_default_resource())
+            : vertices(resource), indices(resource) {
+    }
+
+    Mesh(Mesh &&) = default;
+    Mesh &operator=(Mesh &&) = default;
+    Mesh(const Mesh &) = delete;
+    Mesh &operator=(const Mesh &) = delete;
+
+    MeshView view() const {
+        return MeshView{vertices.data(), vertices.size(), indices.data(), indices.size(), drawRanges, bounds};
+    }
+};
+
+// A reserved part of the builder's arrays. Filling it doesn't touch the builder, so regions can be generated in
+// parallel once every append is done.
+struct MeshRegion {
+    PackedVertex *vertices;
+    GLuint *indices;
+    GLuint baseVertex; // Added to the region's local indices
+
+    // The rest of the region, after the first size vertices & indices
+    MeshRegion advanced(MeshSize size) const {
+        return MeshRegion{vertices + size.vertexCount, indices + size.indexCount,
+                          baseVertex + (GLuint) size.vertexCount};
+    }
+};
+
+struct MeshBuilderStats {
+    size_t allocations = 0; // Buffer (re)allocations, including the initial ones
+    size_t copiedElements = 0; // Vertices & indices copied into a larger buffer
+};
+
+// Generators append straight into the final arrays:
+//   const auto region = builder.appendRegion(MeshSize{n, m});
+//   region.vertices[i] = ...;
+//   region.indices[j] = region.baseVertex + i;
+// The returned pointers are valid until the next append that exceeds the reserved capacity.
+class MeshBuilder {
+private:
+    pmr::memory_resource *resource;
+    Mesh mesh;
+    GLuint rangeIndexOffset = 0;
+    MeshBuilderStats stats;
+
+    void trackGrowth(size_t previousVertexCapacity, size_t previousIndexCapacity, size_t previousVertexCount,
+                     size_t previousIndexCount);
+
+public:
+    explicit MeshBuilder(pmr::memory_resource *resource = pmr::get_default_resource());
+
+    // Makes room for size more vertices & indices on top of what was already appended
+    void reserve(MeshSize size);
+
+    GLuint getBaseVertex() const;
+
+    PackedVertex *appendVertices(size_t count);
+
+    GLuint *appendIndices(size_t count);
+
+    MeshRegion appendRegion(MeshSize size);
+
+    // Indices appended between the two calls become one draw range
+    void beginRange();
+
+    void endRange();
+
+    // Moves the mesh out, leaving the builder empty. The range bounds are computed here, once every region is filled.
+    Mesh build();
+
+    MeshSize getSize() const;
+
+    // For the generators' own temporaries
+    pmr::memory_resource *getResource() const;
+
+    const MeshBuilderStats &getStats() const;
+};
+
+#endif //GC_MESHBUILDER_H
@@ -0,0 +1,415 @@
+#include "MeshOptimizer.h"
+#include <algorithm>
+#include <numeric>
+#include <unordered_map>
+
+MeshOptimizationStats MeshOptimizer::optimize(pmr::vector<PackedVertex> &vertices, pmr::vector<GLuint> &indices,
+                                              vector<DrawRange> &drawRanges) {
+    MeshOptimizationStats stats;
+    stats.vertexCountBefore = vertices.size();
+    // Temporaries come from the same memory resource as the mesh
+    auto *resource = vertices.get_allocator().resource();
+
+    // Absolute indices, as seen by the GPU
+    pmr::vector<GLuint> absoluteIndices(resource);
+    absoluteIndices.reserve(indices.size());
+    for (const auto &drawRange: drawRanges) {
+        for (auto i = drawRange.indexOffset; i < drawRange.indexOffset + drawRange.indexCount; i++) {
+            absoluteIndices.push_back(indices[i] + drawRange.baseVertex);
+        }
+    }
+    stats.before = analyze(absoluteIndices, vertices.size());
+
+    pmr::vector<GLuint> optimizedIndices(resource);
+    optimizedIndices.reserve(indices.size());
+    for (auto &drawRange: drawRanges) {
+        // Local ids for the vertices of this range, skipping degenerate and out of range triangles
+        pmr::unordered_map<GLuint, GLuint> localIds(resource);
+        pmr::vector<GLuint> globalIds(resource);
+        pmr::vector<GLuint> localIndices(resource);
+        localIndices.reserve(drawRange.indexCount);
+        for (auto i = drawRange.indexOffset; i + 2 < drawRange.indexOffset + drawRange.indexCount; i += 3) {
+            const GLint a = (GLint) indices[i] + drawRange.baseVertex;
+            const GLint b = (GLint) indices[i + 1] + drawRange.baseVertex;
+            const GLint c = (GLint) indices[i + 2] + drawRange.baseVertex;
+            const auto isInRange = [&](GLint index) {
+                return index >= 0 && index < (GLint) vertices.size();
+            };
+            if (a == b || b == c || a == c || !isInRange(a) || !isInRange(b) || !isInRange(c)) {
+                stats.degenerateTriangles++;
+                continue;
+            }
+
+            for (const auto index: {(GLuint) a, (GLuint) b, (GLuint) c}) {
+                const auto localId = localIds.emplace(index, (GLuint) globalIds.size());
+                if (localId.second) {
+                    globalIds.push_back(index);
+                }
+                localIndices.push_back(localId.first->second);
+            }
+        }
+
+        // Vertex cache & overdraw, the overdraw order is only kept if it costs little in cache efficiency and
+        // neither is kept if the original order was already better
+        pmr::vector<size_t> clusterStarts(resource);
+        auto cacheIndices = tipsify(localIndices, globalIds.size(), CACHE_SIZE, clusterStarts);
+        pmr::vector<vec3> positions(globalIds.size(), resource);
+        for (auto i = 0; i < globalIds.size(); i++) {
+            positions[i] = vertices[globalIds[i]].position;
+        }
+        pmr::vector<GLuint> overdrawIndices(cacheIndices, resource);
+        sortClustersForOverdraw(overdrawIndices, clusterStarts, positions);
+
+        const auto originalAcmr = analyze(localIndices, globalIds.size()).acmr;
+        const auto cacheAcmr = analyze(cacheIndices, globalIds.size()).acmr;
+        const auto overdrawAcmr = analyze(overdrawIndices, globalIds.size()).acmr;
+        auto &rangeIndices = overdrawAcmr <= cacheAcmr * OVERDRAW_THRESHOLD ? overdrawIndices : cacheIndices;
+        if (std::min(cacheAcmr, overdrawAcmr) > originalAcmr) {
+            rangeIndices = localIndices;
+        }
+
+        drawRange.indexOffset = (GLuint) optimizedIndices.size();
+        drawRange.indexCount = (GLsizei) rangeIndices.size();
+        drawRange.baseVertex = 0;
+        for (const auto index: rangeIndices) {
+            optimizedIndices.push_back(globalIds[index]);
+        }
+    }
+
+    // Vertex fetch - renumber vertices in order of first use
+    const auto UNUSED = (GLuint) -1;
+    pmr::vector<GLuint> remap(vertices.size(), UNUSED, resource);
+    pmr::vector<PackedVertex> optimizedVertices(resource);
+    optimizedVertices.reserve(vertices.size());
+    for (auto &index: optimizedIndices) {
+        if (remap[index] == UNUSED) {
+            remap[index] = (GLuint) optimizedVertices.size();
+            optimizedVertices.push_back(vertices[index]);
+        }
+        index = remap[index];
+    }
+
+    vertices = std::move(optimizedVertices);
+    indices = std::move(optimizedIndices);
+
+    stats.after = analyze(indices, vertices.size());
+    stats.vertexCountAfter = vertices.size();
+    return stats;
+}
+
+WeldStats MeshOptimizer::weld(pmr::vector<PackedVertex> &vertices, pmr::vector<GLuint> &indices, float epsilon) {
+    WeldStats stats;
+    stats.vertexCountBefore = vertices.size();
+    auto *resource = vertices.get_allocator().resource();
+
+    // Spatial hash with cells of size epsilon, so a match is always in one of the 27 neighbouring cells
+    const auto cellOf = [epsilon](const vec3 &position) {
+        return ivec3(floor(position / epsilon));
+    };
+    const auto hashCell = [](const ivec3 &cell) {
+        return ((size_t) (unsigned) cell.x * 73856093u) ^ ((size_t) (unsigned) cell.y * 19349663u) ^
+               ((size_t) (unsigned) cell.z * 83492791u);
+    };
+    const auto isSameAttributes = [](const PackedVertex &a, const PackedVertex &b) {
+        return a.normal == b.normal && a.material == b.material && a.occlusion == b.occlusion && a.light == b.light;
+    };
+
+    pmr::unordered_multimap<size_t, GLuint> cells(resource);
+    cells.reserve(vertices.size());
+    pmr::vector<GLuint> remap(vertices.size(), resource);
+    pmr::vector<PackedVertex> weldedVertices(resource);
+    weldedVertices.reserve(vertices.size());
+    for (auto i = 0; i < vertices.size(); i++) {
+        const auto &vertex = vertices[i];
+        const auto cell = cellOf(vertex.position);
+
+        auto match = (GLuint) -1;
+        for (auto dx = -1; dx <= 1 && match == (GLuint) -1; dx++) {
+            for (auto dy = -1; dy <= 1 && match == (GLuint) -1; dy++) {
+                for (auto dz = -1; dz <= 1 && match == (GLuint) -1; dz++) {
+                    const auto candidates = cells.equal_range(hashCell(cell + ivec3(dx, dy, dz)));
+                    for (auto candidate = candidates.first; candidate != candidates.second; candidate++) {
+                        const auto &welded = weldedVertices[candidate->second];
+                        if (isSameAttributes(vertex, welded) && distance(vertex.position, welded.position) <= epsilon) {
+                            match = candidate->second;
+                            break;
+                        }
+                    }
+                }
+            }
+        }
+
+        if (match == (GLuint) -1) {
+            match = (GLuint) weldedVertices.size();
+            weldedVertices.push_back(vertex);
+            cells.emplace(hashCell(cell), match);
+        }
+        remap[i] = match;
+    }
+
+    for (auto &index: indices) {
+        index = remap[index];
+    }
+    vertices = std::move(weldedVertices);
+
+    stats.vertexCountAfter = vertices.size();
+    return stats;
+}
+
+SubdivisionStats MeshOptimizer::subdivide(pmr::vector<PackedVertex> &vertices, pmr::vector<GLuint> &indices,
+                                           vector<DrawRange> &drawRanges, float maxEdgeLength) {
+    SubdivisionStats stats;
+    stats.triangleCountBefore = indices.size() / 3;
+    stats.vertexCountBefore = vertices.size();
+    auto *resource = vertices.get_allocator().resource();
+
+    // Midpoint vertex of every split edge, keyed by its (ordered) end vertices
+    pmr::unordered_map<uint64_t, GLuint> midpoints(resource);
+    const auto getMidpoint = [&](GLuint a, GLuint b) {
+        const auto key = (uint64_t) std::min(a, b) << 32 | std::max(a, b);
+        const auto midpoint = midpoints.emplace(key, (GLuint) vertices.size());
+        if (midpoint.second) {
+            const auto &vertexA = vertices[a];
+            const auto &vertexB = vertices[b];
+            auto vertex = VertexFormat::pack(
+                    (vertexA.position + vertexB.position) * 0.5f,
+                    VertexFormat::unpackNormal(vertexA.normal) + VertexFormat::unpackNormal(vertexB.normal),
+                    std::min(vertexA.material, vertexB.material)
+            );
+            vertex.occlusion = (GLubyte) ((vertexA.occlusion + vertexB.occlusion) / 2);
+            vertex.light = (GLubyte) ((vertexA.light + vertexB.light) / 2);
+            vertices.push_back(vertex);
+        }
+        return midpoint.first->second;
+    };
+    const auto edgeLength = [&](GLuint a, GLuint b) {
+        return distance(vertices[a].position, vertices[b].position);
+    };
+
+    pmr::vector<GLuint> subdividedIndices(resource);
+    subdividedIndices.reserve(indices.size());
+    pmr::vector<uvec3> pending(resource);
+    for (auto &drawRange: drawRanges) {
+        const auto indexOffset = (GLuint) subdividedIndices.size();
+        for (auto i = drawRange.indexOffset; i + 2 < drawRange.indexOffset + drawRange.indexCount; i += 3) {
+            pending.emplace_back(indices[i] + drawRange.baseVertex, indices[i + 1] + drawRange.baseVertex,
+                                 indices[i + 2] + drawRange.baseVertex);
+            while (!pending.empty()) {
+                auto triangle = pending.back();
+                pending.pop_back();
+
+                // Rotate the longest edge to (x, y), which keeps the winding
+                const auto lengthXY = edgeLength(triangle.x, triangle.y);
+                const auto lengthYZ = edgeLength(triangle.y, triangle.z);
+                const auto lengthZX = edgeLength(triangle.z, triangle.x);
+                if (lengthYZ > lengthXY && lengthYZ >= lengthZX) {
+                    triangle = uvec3(triangle.y, triangle.z, triangle.x);
+                } else if (lengthZX > lengthXY && lengthZX > lengthYZ) {
+                    triangle = uvec3(triangle.z, triangle.x, triangle.y);
+                }
+
+                if (std::max({lengthXY, lengthYZ, lengthZX}) <= maxEdgeLength) {
+                    subdividedIndices.insert(subdividedIndices.end(), {triangle.x, triangle.y, triangle.z});
+                    continue;
+                }
+                const auto midpoint = getMidpoint(triangle.x, triangle.y);
+                pending.emplace_back(triangle.x, midpoint, triangle.z);
+                pending.emplace_back(midpoint, triangle.y, triangle.z);
+            }
+        }
+        drawRange.indexOffset = indexOffset;
+        drawRange.indexCount = (GLsizei) (subdividedIndices.size() - indexOffset);
+        drawRange.baseVertex = 0;
+    }
+    indices = std::move(subdividedIndices);
+
+    stats.triangleCountAfter = indices.size() / 3;
+    stats.vertexCountAfter = vertices.size();
+    return stats;
+}
+
+IndexStats MeshOptimizer::analyze(const pmr::vector<GLuint> &indices, size_t vertexCount, size_t cacheSize) {
+    IndexStats stats;
+    stats.triangleCount = indices.size() / 3;
+
+    // FIFO cache, cacheTimes[v] is the miss counter value when v entered the cache
+    auto *resource = indices.get_allocator().resource();
+    pmr::vector<size_t> cacheTimes(vertexCount, 0, resource);
+    pmr::vector<bool> isReferenced(vertexCount, false, resource);
+    size_t misses = 0;
+    for (const auto index: indices) {
+        if (index >= vertexCount) {
+            continue;
+        }
+
+        if (!isReferenced[index]) {
+            isReferenced[index] = true;
+            stats.vertexCount++;
+        }
+        if (cacheTimes[index] == 0 || misses - cacheTimes[index] >= cacheSize) {
+            misses++;
+            cacheTimes[index] = misses;
+        }
+    }
+
+    if (stats.triangleCount > 0) {
+        stats.acmr = (float) misses / (float) stats.triangleCount;
+    }
+    if (stats.vertexCount > 0) {
+        stats.atvr = (float) misses / (float) stats.vertexCount;
+    }
+    return stats;
+}
+
+pmr::vector<GLuint> MeshOptimizer::tipsify(const pmr::vector<GLuint> &indices, size_t vertexCount, size_t cacheSize,
+                                           pmr::vector<size_t> &clusterStarts) {
+    auto *resource = indices.get_allocator().resource();
+    const auto triangleCount = indices.size() / 3;
+
+    // Vertex -> triangle adjacency
+    pmr::vector<GLuint> liveTriangles(vertexCount, 0, resource);
+    for (const auto index: indices) {
+        liveTriangles[index]++;
+    }
+    pmr::vector<size_t> adjacencyOffsets(vertexCount + 1, 0, resource);
+    for (auto v = 0; v < vertexCount; v++) {
+        adjacencyOffsets[v + 1] = adjacencyOffsets[v] + liveTriangles[v];
+    }
+    pmr::vector<GLuint> adjacency(indices.size(), resource);
+    pmr::vector<size_t> adjacencyFill(adjacencyOffsets.begin(), adjacencyOffsets.end() - 1, resource);
+    for (auto i = 0; i < indices.size(); i++) {
+        adjacency[adjacencyFill[indices[i]]++] = i / 3;
+    }
+
+    pmr::vector<size_t> cacheTimes(vertexCount, 0, resource);
+    pmr::vector<bool> isEmitted(triangleCount, false, resource);
+    pmr::vector<GLuint> deadEnd(resource);
+    pmr::vector<GLuint> candidates(resource);
+    pmr::vector<GLuint> output(resource);
+    output.reserve(indices.size());
+
+    size_t time = cacheSize + 1;
+    size_t cursor = 0;
+    long fanningVertex = vertexCount > 0 ? 0 : -1;
+    clusterStarts.clear();
+    clusterStarts.push_back(0);
+
+    while (fanningVertex >= 0) {
+        // Emit every remaining triangle around the fanning vertex
+        candidates.clear();
+        for (auto a = adjacencyOffsets[fanningVertex]; a < adjacencyOffsets[fanningVertex + 1]; a++) {
+            const auto triangle = adjacency[a];
+            if (isEmitted[triangle]) {
+                continue;
+            }
+
+            for (auto corner = 0; corner < 3; corner++) {
+                const auto vertex = indices[3 * triangle + corner];
+                output.push_back(vertex);
+                deadEnd.push_back(vertex);
+                candidates.push_back(vertex);
+                liveTriangles[vertex]--;
+                if (time - cacheTimes[vertex] > cacheSize) {
+                    cacheTimes[vertex] = time;
+                    time++;
+                }
+            }
+            isEmitted[triangle] = true;
+        }
+
+        // Next fanning vertex - the candidate that will still be in the cache and has the most live triangles
+        long nextVertex = -1;
+        long bestPriority = -1;
+        for (const auto vertex: candidates) {
+            if (liveTriangles[vertex] == 0) {
+                continue;
+            }
+
+            long priority = 0;
+            if (time - cacheTimes[vertex] + 2 * liveTriangles[vertex] <= cacheSize) {
+                priority = (long) (time - cacheTimes[vertex]);
+            }
+            if (priority > bestPriority) {
+                bestPriority = priority;
+                nextVertex = vertex;
+            }
+        }
+
+        if (nextVertex == -1) {
+            // Dead end - back up through recently used vertices, then scan for any vertex with live triangles
+            while (!deadEnd.empty() && nextVertex == -1) {
+                const auto vertex = deadEnd.back();
+                deadEnd.pop_back();
+                if (liveTriangles[vertex] > 0) {
+                    nextVertex = vertex;
+                }
+            }
+            while (cursor < vertexCount && nextVertex == -1) {
+                if (liveTriangles[cursor] > 0) {
+                    nextVertex = (long) cursor;
+                }
+                cursor++;
+            }
+
+            if (nextVertex != -1 && output.size() != clusterStarts.back()) {
+                clusterStarts.push_back(output.size());
+            }
+        }
+        fanningVertex = nextVertex;
+    }
+
+    return output;
+}
+
+void MeshOptimizer::sortClustersForOverdraw(pmr::vector<GLuint> &indices, const pmr::vector<size_t> &clusterStarts,
+                                            const pmr::vector<vec3> &positions) {
+    auto *resource = indices.get_allocator().resource();
+    if (clusterStarts.size() < 2 || positions.empty()) {
+        return;
+    }
+
+    vec3 meshCenter(0.0f);
+    for (const auto &position: positions) {
+        meshCenter += position;
+    }
+    meshCenter /= (float) positions.size();
+
+    // Clusters facing away from the mesh center are likely to occlude the others, draw them first
+    struct Cluster {
+        size_t start, end;
+        float sortKey;
+    };
+    pmr::vector<Cluster> clusters(resource);
+    for (auto c = 0; c < clusterStarts.size(); c++) {
+        const auto start = clusterStarts[c];
+        const auto end = c + 1 < clusterStarts.size() ? clusterStarts[c + 1] : indices.size();
+
+        vec3 centroid(0.0f), normal(0.0f);
+        for (auto i = start; i < end; i += 3) {
+            const auto &a = positions[indices[i]];
+            const auto &b = positions[indices[i + 1]];
+            const auto &d = positions[indices[i + 2]];
+            // Unnormalized, so larger triangles weigh more
+            normal += cross(b - a, d - a);
+            centroid += (a + b + d) / 3.0f;
+        }
+        const auto area = length(normal);
+        if (area > 0.0f) {
+            normal /= area;
+        }
+        centroid /= (float) std::max((end - start) / 3, (size_t) 1);
+
+        clusters.push_back(Cluster{start, end, dot(centroid - meshCenter, normal)});
+    }
+
+    stable_sort(clusters.begin(), clusters.end(), [](const Cluster &a, const Cluster &b) {
+        return a.sortKey > b.sortKey;
+    });
+
+    pmr::vector<GLuint> sortedIndices(resource);
+    sortedIndices.reserve(indices.size());
+    for (const auto &cluster: clusters) {
+        sortedIndices.insert(sortedIndices.end(), indices.begin() + cluster.start, indices.begin() + cluster.end);
+    }
+    indices = std::move(sortedIndices);
+}
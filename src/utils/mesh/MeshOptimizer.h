@@ -0,0 +1,79 @@
+#ifndef GC_MESHOPTIMIZER_H
+#define GC_MESHOPTIMIZER_H
+
+#include <GL/glew.h>
+#include <vector>
+#include <memory_resource>
+#include "../render/VertexFormat.h"
+#include "../render/DrawTable.h"
+
+using namespace std;
+
+struct IndexStats {
+    size_t triangleCount = 0;
+    size_t vertexCount = 0; // Distinct vertices referenced
+    // Average cache miss ratio (misses per triangle) and average transform to vertex ratio (misses per vertex)
+    float acmr = 0.0f;
+    float atvr = 0.0f;
+};
+
+struct WeldStats {
+    size_t vertexCountBefore = 0;
+    size_t vertexCountAfter = 0;
+};
+
+struct SubdivisionStats {
+    size_t triangleCountBefore = 0;
+    size_t triangleCountAfter = 0;
+    size_t vertexCountBefore = 0;
+    size_t vertexCountAfter = 0;
+};
+
+struct MeshOptimizationStats {
+    IndexStats before;
+    IndexStats after;
+    size_t degenerateTriangles = 0;
+    size_t vertexCountBefore = 0;
+    size_t vertexCountAfter = 0;
+};
+
+// Initialization-time index buffer optimization, run per draw range:
+//  1. degenerate triangles are removed
+//  2. triangles are reordered for the post-transform vertex cache (Tipsify, Sander et al. 2007)
+//  3. the resulting clusters are sorted outside-in to reduce overdraw
+//  4. vertices are reordered by first use for fetch locality, unreferenced ones are dropped
+// Afterwards the ranges are packed back to back and all have a base vertex of 0.
+class MeshOptimizer {
+public:
+    static constexpr size_t CACHE_SIZE = 16;
+    // Largest ACMR increase accepted in exchange for the overdraw order
+    static constexpr float OVERDRAW_THRESHOLD = 1.05f;
+    static constexpr float WELD_EPSILON = 0.001f;
+
+    static MeshOptimizationStats optimize(pmr::vector<PackedVertex> &vertices, pmr::vector<GLuint> &indices,
+                                          vector<DrawRange> &drawRanges);
+
+    // Merges vertices whose positions are within epsilon and whose (already quantized) normal and material
+    // match exactly, keeping the first of each group. Indices must be absolute (base vertex 0).
+    static WeldStats weld(pmr::vector<PackedVertex> &vertices, pmr::vector<GLuint> &indices,
+                          float epsilon = WELD_EPSILON);
+
+    // Splits triangles at the midpoint of their longest edge until no edge is longer than maxEdgeLength, so
+    // per-vertex attributes (baked lighting) have enough resolution on large faces. An edge is split the same way
+    // from both of its triangles, so no T-junctions are introduced. Indices must be absolute (base vertex 0).
+    static SubdivisionStats subdivide(pmr::vector<PackedVertex> &vertices, pmr::vector<GLuint> &indices,
+                                      vector<DrawRange> &drawRanges, float maxEdgeLength);
+
+    // FIFO cache simulation over triangles referencing vertices by absolute index
+    static IndexStats analyze(const pmr::vector<GLuint> &indices, size_t vertexCount, size_t cacheSize = CACHE_SIZE);
+
+private:
+    // Reorders triangles given in local vertex ids, clusterStarts receives the offset of every cluster
+    static pmr::vector<GLuint> tipsify(const pmr::vector<GLuint> &indices, size_t vertexCount, size_t cacheSize,
+                                       pmr::vector<size_t> &clusterStarts);
+
+    static void sortClustersForOverdraw(pmr::vector<GLuint> &indices, const pmr::vector<size_t> &clusterStarts,
+                                        const pmr::vector<vec3> &positions);
+};
+
+#endif //GC_MESHOPTIMIZER_H
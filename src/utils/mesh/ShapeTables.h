@@ -0,0 +1,145 @@
+#ifndef GC_SHAPETABLES_H
+#define GC_SHAPETABLES_H
+
+#include <GL/glew.h>
+#include <array>
+
+using namespace std;
+
+// Unit shapes computed at compile time, so instantiating a shape is a scale & offset of the table.
+// Vertices are stored meridian by meridian, each meridian going from the bottom (u = -PI/2) to the top (u = PI/2).
+class ShapeTables {
+public:
+    static constexpr double PI = 3.14159265358979323846;
+
+    // std::sin/std::cos aren't constexpr - Taylor series after reducing the angle to [-PI, PI]
+    static constexpr double sine(double angle) {
+        while (angle > PI) {
+            angle -= 2 * PI;
+        }
+        while (angle < -PI) {
+            angle += 2 * PI;
+        }
+
+        double term = angle, sum = angle;
+        for (auto n = 1; n < 20; n++) {
+            term *= -angle * angle / ((2 * n) * (2 * n + 1));
+            sum += term;
+        }
+        return sum;
+    }
+
+    static constexpr double cosine(double angle) {
+        return sine(angle + PI / 2);
+    }
+
+    // Same layout as VertexFormat::packNormal, for a normal that is already unit length
+    static constexpr GLuint packUnitNormal(double x, double y, double z) {
+        const auto quantize = [](double value) {
+            return (GLint) (value * 511.0 + (value >= 0.0 ? 0.5 : -0.5));
+        };
+        return ((GLuint) quantize(x) & 0x3FFu) | (((GLuint) quantize(y) & 0x3FFu) << 10) |
+               (((GLuint) quantize(z) & 0x3FFu) << 20);
+    }
+
+    // Two triangles per quad between neighbouring meridians, the last meridian wraps around to the first
+    template<int PARALLELS, int MERIDIANS>
+    static constexpr array<GLuint, 6 * PARALLELS * MERIDIANS> gridIndices() {
+        array<GLuint, 6 * PARALLELS * MERIDIANS> indices{};
+        auto index = 0;
+        for (auto meridian = 0; meridian < MERIDIANS; meridian++) {
+            for (auto parallel = 0; parallel < PARALLELS; parallel++) {
+                const auto indexA = meridian * (PARALLELS + 1) + parallel;
+                auto indexB = indexA + (PARALLELS + 1);
+                auto indexC = indexB + 1;
+                const auto indexD = indexA + 1;
+                if (meridian == MERIDIANS - 1) {
+                    indexB = indexB % (PARALLELS + 1);
+                    indexC = indexC % (PARALLELS + 1);
+                }
+
+                indices[index++] = indexA;
+                indices[index++] = indexB;
+                indices[index++] = indexC;
+
+                indices[index++] = indexA;
+                indices[index++] = indexC;
+                indices[index++] = indexD;
+            }
+        }
+        return indices;
+    }
+};
+
+// Sphere of radius 1 around the origin, the position is also the normal
+template<int PARALLELS, int MERIDIANS>
+struct SphereTable {
+    static constexpr int VERTEX_COUNT = (PARALLELS + 1) * MERIDIANS;
+    static constexpr int INDEX_COUNT = 6 * PARALLELS * MERIDIANS;
+
+    static constexpr array<GLuint, VERTEX_COUNT> computePackedNormals() {
+        array<GLuint, VERTEX_COUNT> normals{};
+        for (auto meridian = 0; meridian < MERIDIANS; meridian++) {
+            for (auto parallel = 0; parallel < PARALLELS + 1; parallel++) {
+                const auto u = -ShapeTables::PI / 2 + parallel * ShapeTables::PI / PARALLELS;
+                const auto v = meridian * 2 * ShapeTables::PI / MERIDIANS;
+
+                normals[meridian * (PARALLELS + 1) + parallel] = ShapeTables::packUnitNormal(
+                        ShapeTables::cosine(u) * ShapeTables::cosine(v),
+                        ShapeTables::cosine(u) * ShapeTables::sine(v),
+                        ShapeTables::sine(u)
+                );
+            }
+        }
+        return normals;
+    }
+
+    static constexpr array<float, 3 * VERTEX_COUNT> computePositions() {
+        array<float, 3 * VERTEX_COUNT> positions{};
+        for (auto meridian = 0; meridian < MERIDIANS; meridian++) {
+            for (auto parallel = 0; parallel < PARALLELS + 1; parallel++) {
+                const auto u = -ShapeTables::PI / 2 + parallel * ShapeTables::PI / PARALLELS;
+                const auto v = meridian * 2 * ShapeTables::PI / MERIDIANS;
+
+                const auto vertexIndex = meridian * (PARALLELS + 1) + parallel;
+                positions[3 * vertexIndex] = (float) (ShapeTables::cosine(u) * ShapeTables::cosine(v));
+                positions[3 * vertexIndex + 1] = (float) (ShapeTables::cosine(u) * ShapeTables::sine(v));
+                positions[3 * vertexIndex + 2] = (float) ShapeTables::sine(u);
+            }
+        }
+        return positions;
+    }
+
+    static constexpr array<float, 3 * VERTEX_COUNT> POSITIONS = computePositions();
+    static constexpr array<GLuint, VERTEX_COUNT> PACKED_NORMALS = computePackedNormals();
+    static constexpr array<GLuint, INDEX_COUNT> INDICES = ShapeTables::gridIndices<PARALLELS, MERIDIANS>();
+};
+
+// Cylinder of radius 1 and height 1 around the origin. Its normals depend on the radius to height ratio
+// (they point away from the center), so they are packed when the shape is instantiated.
+template<int PARALLELS, int MERIDIANS>
+struct CylinderTable {
+    static constexpr int VERTEX_COUNT = (PARALLELS + 1) * MERIDIANS;
+    static constexpr int INDEX_COUNT = 6 * PARALLELS * MERIDIANS;
+
+    static constexpr array<float, 3 * VERTEX_COUNT> computePositions() {
+        array<float, 3 * VERTEX_COUNT> positions{};
+        for (auto meridian = 0; meridian < MERIDIANS; meridian++) {
+            for (auto parallel = 0; parallel < PARALLELS + 1; parallel++) {
+                const auto u = -ShapeTables::PI / 2 + parallel * ShapeTables::PI / PARALLELS;
+                const auto v = meridian * 2 * ShapeTables::PI / MERIDIANS;
+
+                const auto vertexIndex = meridian * (PARALLELS + 1) + parallel;
+                positions[3 * vertexIndex] = (float) ShapeTables::cosine(v);
+                positions[3 * vertexIndex + 1] = (float) (u / ShapeTables::PI);
+                positions[3 * vertexIndex + 2] = (float) ShapeTables::sine(v);
+            }
+        }
+        return positions;
+    }
+
+    static constexpr array<float, 3 * VERTEX_COUNT> POSITIONS = computePositions();
+    static constexpr array<GLuint, INDEX_COUNT> INDICES = ShapeTables::gridIndices<PARALLELS, MERIDIANS>();
+};
+
+#endif //GC_SHAPETABLES_H
@@ -0,0 +1,192 @@
+#include "FrameProfiler.h"
+#include <algorithm>
+#include <iomanip>
+
+FrameProfiler::Scope::Scope(FrameProfiler &profiler, StageId stage)
+        : profiler(profiler), stage(stage), start(chrono::steady_clock::now()) {
+}
+
+FrameProfiler::Scope::~Scope() {
+    const auto elapsed = chrono::duration<float, milli>(chrono::steady_clock::now() - start).count();
+    profiler.addStageTime(stage, elapsed);
+}
+
+FrameProfiler::StageId FrameProfiler::addStage(const string &name) {
+    stageNames.push_back(name);
+    return stageNames.size() - 1;
+}
+
+void FrameProfiler::initialize(size_t windowSize) {
+    this->windowSize = windowSize;
+    samples.assign(stageNames.size() + 2, deque<float>());
+
+    for (auto &query: gpuQueries) {
+        glGenQueries(1, &query.id);
+        query.isPending = false;
+    }
+}
+
+bool FrameProfiler::openCsv(const string &path) {
+    csv.open(path);
+    if (!csv) {
+        cout << "ERROR::PROFILER::CANNOT_WRITE " << path << endl;
+        return false;
+    }
+
+    csv << "frame,total_ms";
+    for (const auto &name: stageNames) {
+        csv << "," << name << "_ms";
+    }
+    csv << ",gpu_ms\n";
+    return true;
+}
+
+void FrameProfiler::beginFrame() {
+    collectGpuQueries();
+    flushRows(false);
+
+    frameStart = chrono::steady_clock::now();
+    currentRow = FrameRow{frameIndex, 0.0f, vector<float>(stageNames.size(), 0.0f), -1.0f};
+}
+
+void FrameProfiler::endFrame() {
+    currentRow.totalMs = chrono::duration<float, milli>(chrono::steady_clock::now() - frameStart).count();
+
+    addSample(0, currentRow.totalMs);
+    for (auto stage = 0; stage < stageNames.size(); stage++) {
+        addSample(stage + 1, currentRow.stageMs[stage]);
+    }
+
+    pendingRows.push_back(currentRow);
+    frameIndex++;
+}
+
+void FrameProfiler::beginGpuTimer() {
+    auto &query = gpuQueries[gpuQueryCursor];
+    if (query.isPending) {
+        // Still not back after GPU_QUERY_COUNT frames - drop it rather than stall
+        GLint isAvailable = 0;
+        glGetQueryObjectiv(query.id, GL_QUERY_RESULT_AVAILABLE, &isAvailable);
+        if (!isAvailable) {
+            return;
+        }
+        collectGpuQueries();
+    }
+
+    glBeginQuery(GL_TIME_ELAPSED, query.id);
+    query.frame = frameIndex;
+    isGpuTimerRunning = true;
+}
+
+void FrameProfiler::endGpuTimer() {
+    if (!isGpuTimerRunning) {
+        return;
+    }
+
+    glEndQuery(GL_TIME_ELAPSED);
+    gpuQueries[gpuQueryCursor].isPending = true;
+    gpuQueryCursor = (gpuQueryCursor + 1) % GPU_QUERY_COUNT;
+    isGpuTimerRunning = false;
+}
+
+void FrameProfiler::addStageTime(StageId stage, float milliseconds) {
+    currentRow.stageMs[stage] += milliseconds;
+}
+
+void FrameProfiler::collectGpuQueries() {
+    for (auto &query: gpuQueries) {
+        if (!query.isPending) {
+            continue;
+        }
+
+        GLint isAvailable = 0;
+        glGetQueryObjectiv(query.id, GL_QUERY_RESULT_AVAILABLE, &isAvailable);
+        if (!isAvailable) {
+            continue;
+        }
+
+        GLuint64 elapsedNs = 0;
+        glGetQueryObjectui64v(query.id, GL_QUERY_RESULT, &elapsedNs);
+        query.isPending = false;
+
+        const auto gpuMs = (float) elapsedNs / 1.0e6f;
+        addSample(stageNames.size() + 1, gpuMs);
+        for (auto &row: pendingRows) {
+            if (row.frame == query.frame) {
+                row.gpuMs = gpuMs;
+            }
+        }
+    }
+}
+
+void FrameProfiler::flushRows(bool isFinal) {
+    while (!pendingRows.empty()) {
+        const auto &row = pendingRows.front();
+        if (!isFinal && row.gpuMs < 0.0f && row.frame + GPU_QUERY_COUNT > frameIndex) {
+            break;
+        }
+
+        if (csv.is_open()) {
+            csv << row.frame << "," << row.totalMs;
+            for (const auto stageMs: row.stageMs) {
+                csv << "," << stageMs;
+            }
+            csv << ",";
+            if (row.gpuMs >= 0.0f) {
+                csv << row.gpuMs;
+            }
+            csv << "\n";
+        }
+        pendingRows.pop_front();
+    }
+}
+
+void FrameProfiler::addSample(size_t series, float value) {
+    auto &window = samples[series];
+    window.push_back(value);
+    if (window.size() > windowSize) {
+        window.pop_front();
+    }
+}
+
+float FrameProfiler::percentile(vector<float> &values, float fraction) {
+    const auto rank = (size_t) (fraction * (float) (values.size() - 1) + 0.5f);
+    nth_element(values.begin(), values.begin() + rank, values.end());
+    return values[rank];
+}
+
+void FrameProfiler::printSummary(ostream &out) const {
+    auto printSeries = [&](const string &name, const deque<float> &window) {
+        if (window.empty()) {
+            return;
+        }
+
+        vector<float> values(window.begin(), window.end());
+        out << "  " << left << setw(10) << name << right << fixed << setprecision(3)
+            << " p50 " << setw(8) << percentile(values, 0.50f) << " ms"
+            << "  p95 " << setw(8) << percentile(values, 0.95f) << " ms"
+            << "  p99 " << setw(8) << percentile(values, 0.99f) << " ms" << endl;
+        out << defaultfloat;
+    };
+
+    out << "Frame profile (last " << samples[0].size() << " frames):" << endl;
+    printSeries("frame", samples[0]);
+    for (auto stage = 0; stage < stageNames.size(); stage++) {
+        printSeries(stageNames[stage], samples[stage + 1]);
+    }
+    printSeries("gpu", samples[stageNames.size() + 1]);
+}
+
+void FrameProfiler::cleanUp() {
+    // Shutting down anyway, let the last queries finish
+    glFinish();
+    collectGpuQueries();
+    flushRows(true);
+    if (csv.is_open()) {
+        csv.close();
+    }
+
+    for (auto &query: gpuQueries) {
+        glDeleteQueries(1, &query.id);
+    }
+}
@@ -0,0 +1,98 @@
+#ifndef GC_FRAMEPROFILER_H
+#define GC_FRAMEPROFILER_H
+
+#include <GL/glew.h>
+#include <chrono>
+#include <deque>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+// Per-frame CPU stage timers and a GPU timer, with a rolling p50/p95/p99 summary and an optional
+// per-frame CSV dump. GPU times come from GL_TIME_ELAPSED queries kept in a small ring and are only
+// read back once available, so the profiler never waits on the GPU; a frame's row is written once
+// its GPU time arrived (or was given up on).
+class FrameProfiler {
+public:
+    typedef size_t StageId;
+
+    class Scope {
+    public:
+        Scope(FrameProfiler &profiler, StageId stage);
+
+        ~Scope();
+
+    private:
+        FrameProfiler &profiler;
+        StageId stage;
+        chrono::steady_clock::time_point start;
+    };
+
+    StageId addStage(const string &name);
+
+    // Call once the GL context exists
+    void initialize(size_t windowSize = 600);
+
+    bool openCsv(const string &path);
+
+    void beginFrame();
+
+    void endFrame();
+
+    void beginGpuTimer();
+
+    void endGpuTimer();
+
+    void addStageTime(StageId stage, float milliseconds);
+
+    void printSummary(ostream &out) const;
+
+    void cleanUp();
+
+private:
+    // Frames a GPU query may stay in flight before its result is given up on
+    static const size_t GPU_QUERY_COUNT = 4;
+
+    struct FrameRow {
+        size_t frame;
+        float totalMs;
+        vector<float> stageMs;
+        float gpuMs;
+    };
+
+    struct GpuQuery {
+        GLuint id;
+        size_t frame;
+        bool isPending;
+    };
+
+    vector<string> stageNames;
+
+    size_t windowSize = 0;
+    // Rolling windows, index 0 is the frame total, then each stage, then the GPU time
+    vector<deque<float>> samples;
+
+    size_t frameIndex = 0;
+    chrono::steady_clock::time_point frameStart;
+    FrameRow currentRow;
+    deque<FrameRow> pendingRows;
+
+    GpuQuery gpuQueries[GPU_QUERY_COUNT] = {};
+    size_t gpuQueryCursor = 0;
+    bool isGpuTimerRunning = false;
+
+    ofstream csv;
+
+    void collectGpuQueries();
+
+    void flushRows(bool isFinal);
+
+    void addSample(size_t series, float value);
+
+    static float percentile(vector<float> &values, float fraction);
+};
+
+#endif //GC_FRAMEPROFILER_H
@@ -0,0 +1,256 @@
+#include "ClusteredLights.h"
+#include <algorithm>
+#include <cfloat>
+#include <chrono>
+#include <iostream>
+
+void ClusteredLights::initialize(ThreadPool &threadPool) {
+    this->threadPool = &threadPool;
+    glGetIntegerv(GL_MAX_TEXTURE_BUFFER_SIZE, &maxTexelCount);
+
+    ClusterConstants constants{};
+    constants.counts = ivec4(TILES_X, TILES_Y, SLICES, 0);
+    constants.depths = vec4(NEAR_SLICE_DEPTH, 0.0f, 0.0f, 0.0f);
+    glGenBuffers(1, &ubo);
+    glBindBuffer(GL_UNIFORM_BUFFER, ubo);
+    glBufferData(GL_UNIFORM_BUFFER, sizeof(ClusterConstants), &constants, GL_DYNAMIC_DRAW);
+    glBindBuffer(GL_UNIFORM_BUFFER, 0);
+    glBindBufferBase(GL_UNIFORM_BUFFER, BINDING, ubo);
+
+    // Empty lists until the first update, so the shaders never read unset storage
+    clusters.assign(CLUSTER_COUNT, uvec2(0));
+    auto createBufferTexture = [](GLuint &buffer, GLuint &texture, GLenum format, GLint unit, GLsizeiptr size,
+                                  const void *data) {
+        glGenBuffers(1, &buffer);
+        glBindBuffer(GL_TEXTURE_BUFFER, buffer);
+        glBufferData(GL_TEXTURE_BUFFER, size, data, GL_DYNAMIC_DRAW);
+        glGenTextures(1, &texture);
+        glActiveTexture(GL_TEXTURE0 + unit);
+        glBindTexture(GL_TEXTURE_BUFFER, texture);
+        glTexBuffer(GL_TEXTURE_BUFFER, format, buffer);
+    };
+    const vec4 noLight[2] = {};
+    const GLuint noIndex = 0;
+    createBufferTexture(lightBuffer, lightTexture, GL_RGBA32F, LIGHTS_UNIT, sizeof(noLight), noLight);
+    createBufferTexture(clusterBuffer, clusterTexture, GL_RG32UI, CLUSTERS_UNIT,
+                        CLUSTER_COUNT * sizeof(uvec2), clusters.data());
+    createBufferTexture(indexBuffer, indexTexture, GL_R32UI, INDICES_UNIT, sizeof(noIndex), &noIndex);
+    indexBufferSize = sizeof(noIndex);
+    glActiveTexture(GL_TEXTURE0);
+    glBindBuffer(GL_TEXTURE_BUFFER, 0);
+
+    sliceIndices.resize(SLICES);
+}
+
+void ClusteredLights::bindProgram(GLuint program) {
+    const auto blockIndex = glGetUniformBlockIndex(program, "Clusters");
+    if (blockIndex != GL_INVALID_INDEX) {
+        glUniformBlockBinding(program, blockIndex, BINDING);
+    }
+
+    // The program is in use
+    for (const auto &[name, unit]: {pair<const char *, GLint>{"pointLights", LIGHTS_UNIT},
+                                    pair<const char *, GLint>{"clusterLights", CLUSTERS_UNIT},
+                                    pair<const char *, GLint>{"lightIndices", INDICES_UNIT}}) {
+        const auto location = glGetUniformLocation(program, name);
+        if (location != -1) {
+            glUniform1i(location, unit);
+        }
+    }
+}
+
+void ClusteredLights::setLights(const vector<PointLight> &lights) {
+    this->lights = lights;
+    areLightsDirty = true;
+}
+
+size_t ClusteredLights::getLightCount() const {
+    return lights.size();
+}
+
+void ClusteredLights::uploadLights() {
+    // 2 texels per light - position & radius, color & intensity
+    const auto maxLightCount = (size_t) maxTexelCount / 2;
+    if (lights.size() > maxLightCount) {
+        cout << "ERROR::LIGHTS::TOO_MANY_LIGHTS " << lights.size() << " of " << maxLightCount << endl;
+        lights.resize(maxLightCount);
+    }
+
+    if (!lights.empty()) {
+        glBindBuffer(GL_TEXTURE_BUFFER, lightBuffer);
+        glBufferData(GL_TEXTURE_BUFFER, (GLsizeiptr) (lights.size() * sizeof(PointLight)), lights.data(),
+                     GL_STATIC_DRAW);
+        glBindBuffer(GL_TEXTURE_BUFFER, 0);
+    }
+    areLightsDirty = false;
+}
+
+int ClusteredLights::getSlice(float depth, float sliceScale, float sliceBias) const {
+    if (depth < NEAR_SLICE_DEPTH) {
+        return 0;
+    }
+    return std::clamp((int) floor(log(depth) * sliceScale + sliceBias), 1, SLICES - 1);
+}
+
+void ClusteredLights::update(const mat4 &projection, const mat4 &view, int width, int height, float nearPlane,
+                             float farPlane) {
+    const auto start = chrono::steady_clock::now();
+    if (areLightsDirty) {
+        uploadLights();
+    }
+
+    const auto sliceScale = (float) (SLICES - 1) / log(farPlane / NEAR_SLICE_DEPTH);
+    const auto sliceBias = 1.0f - log(NEAR_SLICE_DEPTH) * sliceScale;
+
+    // Clusters each light reaches, from the screen rect & depth range of its bounding box in view space
+    lightRanges.resize(lights.size());
+    threadPool->parallelFor(lights.size(), [&](size_t begin, size_t end) {
+        for (auto i = begin; i < end; i++) {
+            auto &range = lightRanges[i];
+            range = LightRange{0, -1, 0, -1, 0, -1};
+
+            const auto center = vec3(view * vec4(lights[i].position, 1.0f));
+            const auto radius = lights[i].radius;
+            if (center.z + radius < nearPlane || center.z - radius > farPlane) {
+                continue;
+            }
+
+            const auto minDepth = std::max(center.z - radius, nearPlane);
+            const auto maxDepth = std::min(center.z + radius, farPlane);
+            auto ndcMin = vec2(FLT_MAX), ndcMax = vec2(-FLT_MAX);
+            for (auto corner = 0; corner < 8; corner++) {
+                const auto clip = projection * vec4(
+                        center.x + (corner & 1 ? radius : -radius),
+                        center.y + (corner & 2 ? radius : -radius),
+                        corner & 4 ? maxDepth : minDepth,
+                        1.0f
+                );
+                const auto ndc = vec2(clip.x, clip.y) / clip.w;
+                ndcMin = glm::min(ndcMin, ndc);
+                ndcMax = glm::max(ndcMax, ndc);
+            }
+            if (ndcMax.x < -1.0f || ndcMin.x > 1.0f || ndcMax.y < -1.0f || ndcMin.y > 1.0f) {
+                continue;
+            }
+
+            range.minX = std::clamp((int) floor((ndcMin.x * 0.5f + 0.5f) * TILES_X), 0, TILES_X - 1);
+            range.maxX = std::clamp((int) floor((ndcMax.x * 0.5f + 0.5f) * TILES_X), 0, TILES_X - 1);
+            range.minY = std::clamp((int) floor((ndcMin.y * 0.5f + 0.5f) * TILES_Y), 0, TILES_Y - 1);
+            range.maxY = std::clamp((int) floor((ndcMax.y * 0.5f + 0.5f) * TILES_Y), 0, TILES_Y - 1);
+            range.minSlice = getSlice(minDepth, sliceScale, sliceBias);
+            range.maxSlice = getSlice(maxDepth, sliceScale, sliceBias);
+        }
+    }, 256);
+
+    // One job per slice, each counting then filling the lists of its own clusters
+    const auto tileCount = TILES_X * TILES_Y;
+    threadPool->parallelFor(SLICES, [&](size_t begin, size_t end) {
+        for (auto slice = (int) begin; slice < end; slice++) {
+            GLuint counts[tileCount] = {};
+            for (const auto &range: lightRanges) {
+                if (slice < range.minSlice || slice > range.maxSlice) {
+                    continue;
+                }
+                for (auto y = range.minY; y <= range.maxY; y++) {
+                    for (auto x = range.minX; x <= range.maxX; x++) {
+                        counts[y * TILES_X + x]++;
+                    }
+                }
+            }
+
+            GLuint offset = 0;
+            for (auto tile = 0; tile < tileCount; tile++) {
+                clusters[slice * tileCount + tile] = uvec2(offset, counts[tile]);
+                counts[tile] = offset;
+                offset += clusters[slice * tileCount + tile].y;
+            }
+
+            auto &list = sliceIndices[slice];
+            list.resize(offset);
+            for (auto light = 0; light < lightRanges.size(); light++) {
+                const auto &range = lightRanges[light];
+                if (slice < range.minSlice || slice > range.maxSlice) {
+                    continue;
+                }
+                for (auto y = range.minY; y <= range.maxY; y++) {
+                    for (auto x = range.minX; x <= range.maxX; x++) {
+                        list[counts[y * TILES_X + x]++] = light;
+                    }
+                }
+            }
+        }
+    }, 1);
+
+    // Slices concatenated in order - lists past what a buffer texture can address are cut short
+    GLuint sliceOffsets[SLICES];
+    GLuint indexCount = 0;
+    for (auto slice = 0; slice < SLICES; slice++) {
+        sliceOffsets[slice] = indexCount;
+        indexCount += sliceIndices[slice].size();
+    }
+    indices.resize(std::min(indexCount, (GLuint) maxTexelCount));
+    threadPool->parallelFor(SLICES, [&](size_t begin, size_t end) {
+        for (auto slice = begin; slice < end; slice++) {
+            const auto &list = sliceIndices[slice];
+            const auto copyCount = std::min(list.size(), indices.size() - std::min((size_t) sliceOffsets[slice],
+                                                                                   indices.size()));
+            copy(list.begin(), list.begin() + (ptrdiff_t) copyCount, indices.begin() + sliceOffsets[slice]);
+            for (auto tile = 0; tile < tileCount; tile++) {
+                auto &cluster = clusters[slice * tileCount + tile];
+                cluster.x += sliceOffsets[slice];
+                const auto available = cluster.x < indices.size() ? (GLuint) (indices.size() - cluster.x) : 0u;
+                cluster.y = std::min(cluster.y, available);
+            }
+        }
+    }, 1);
+
+    // Upload
+    ClusterConstants constants{};
+    constants.scale = vec4((float) TILES_X / (float) std::max(width, 1), (float) TILES_Y / (float) std::max(height, 1),
+                           sliceScale, sliceBias);
+    constants.counts = ivec4(TILES_X, TILES_Y, SLICES, 0);
+    constants.depths = vec4(NEAR_SLICE_DEPTH, 0.0f, 0.0f, 0.0f);
+    glBindBuffer(GL_UNIFORM_BUFFER, ubo);
+    glBufferSubData(GL_UNIFORM_BUFFER, 0, sizeof(ClusterConstants), &constants);
+    glBindBuffer(GL_UNIFORM_BUFFER, 0);
+
+    glBindBuffer(GL_TEXTURE_BUFFER, clusterBuffer);
+    glBufferSubData(GL_TEXTURE_BUFFER, 0, CLUSTER_COUNT * sizeof(uvec2), clusters.data());
+    if (!indices.empty()) {
+        const auto indicesSize = (GLsizeiptr) (indices.size() * sizeof(GLuint));
+        glBindBuffer(GL_TEXTURE_BUFFER, indexBuffer);
+        if (indicesSize > indexBufferSize) {
+            // Grown with some headroom, the texture keeps pointing at the buffer
+            indexBufferSize = indicesSize + indicesSize / 2;
+            glBufferData(GL_TEXTURE_BUFFER, indexBufferSize, nullptr, GL_DYNAMIC_DRAW);
+        }
+        glBufferSubData(GL_TEXTURE_BUFFER, 0, indicesSize, indices.data());
+    }
+    glBindBuffer(GL_TEXTURE_BUFFER, 0);
+
+    // Statistics
+    stats = ClusteredLightsStats();
+    for (const auto &range: lightRanges) {
+        stats.visibleLightCount += range.maxSlice >= range.minSlice ? 1 : 0;
+    }
+    for (const auto &cluster: clusters) {
+        stats.occupiedClusterCount += cluster.y > 0 ? 1 : 0;
+        stats.maxClusterLightCount = std::max(stats.maxClusterLightCount, (size_t) cluster.y);
+    }
+    stats.indexCount = indices.size();
+    stats.assignMilliseconds = chrono::duration<float, milli>(chrono::steady_clock::now() - start).count();
+}
+
+const ClusteredLightsStats &ClusteredLights::getStats() const {
+    return stats;
+}
+
+void ClusteredLights::cleanUp() {
+    glDeleteTextures(1, &lightTexture);
+    glDeleteTextures(1, &clusterTexture);
+    glDeleteTextures(1, &indexTexture);
+    glDeleteBuffers(1, &lightBuffer);
+    glDeleteBuffers(1, &clusterBuffer);
+    glDeleteBuffers(1, &indexBuffer);
+    glDeleteBuffers(1, &ubo);
+}
@@ -0,0 +1,99 @@
+#ifndef GC_CLUSTEREDLIGHTS_H
+#define GC_CLUSTEREDLIGHTS_H
+
+#include <GL/glew.h>
+#include <glm/glm.hpp>
+#include <vector>
+#include "../jobs/ThreadPool.h"
+
+using namespace std;
+using namespace glm;
+
+struct PointLight {
+    vec3 position;
+    float radius; // No light past it
+    vec3 color;
+    float intensity;
+};
+
+static_assert(sizeof(PointLight) == 2 * sizeof(vec4), "PointLight must be 2 RGBA32F texels");
+
+struct ClusteredLightsStats {
+    size_t visibleLightCount = 0;
+    size_t occupiedClusterCount = 0;
+    size_t indexCount = 0;
+    size_t maxClusterLightCount = 0;
+    float assignMilliseconds = 0.0f;
+};
+
+// Clustered forward lighting - the view frustum is split into a grid of screen tiles times depth slices, and every
+// cluster gets the list of point lights reaching into it. The fragment shader finds its cluster from gl_FragCoord
+// and the view depth, then only shades with that list, so the cost follows the local light density.
+// The lists are built on the CPU (one job per depth slice) and read by the shaders through buffer textures.
+class ClusteredLights {
+public:
+    static const int TILES_X = 16;
+    static const int TILES_Y = 9;
+    static const int SLICES = 24;
+    static const int CLUSTER_COUNT = TILES_X * TILES_Y * SLICES;
+    // Slice 0 covers everything nearer, the rest are exponential up to the far plane
+    static constexpr float NEAR_SLICE_DEPTH = 5.0f;
+
+    static const GLuint BINDING = 2;
+    // Texture units of the samplerBuffers in shader.frag
+    static const GLint LIGHTS_UNIT = 1;
+    static const GLint CLUSTERS_UNIT = 2;
+    static const GLint INDICES_UNIT = 3;
+
+    void initialize(ThreadPool &threadPool);
+
+    // Points the program's Clusters block and samplers at the shared buffers
+    static void bindProgram(GLuint program);
+
+    void setLights(const vector<PointLight> &lights);
+
+    size_t getLightCount() const;
+
+    // Rebuilds and uploads the cluster lists for the camera
+    void update(const mat4 &projection, const mat4 &view, int width, int height, float nearPlane, float farPlane);
+
+    const ClusteredLightsStats &getStats() const;
+
+    void cleanUp();
+
+private:
+    // Mirrors the std140 Clusters block in shader.frag
+    struct ClusterConstants {
+        vec4 scale; // x, y = tiles per pixel, z, w = slice = log(depth) * z + w
+        ivec4 counts; // x, y = tiles, z = slices
+        vec4 depths; // x = NEAR_SLICE_DEPTH
+    };
+
+    // Clusters a light reaches, inclusive - empty when maxSlice < minSlice
+    struct LightRange {
+        int minX, maxX, minY, maxY, minSlice, maxSlice;
+    };
+
+    ThreadPool *threadPool = nullptr;
+    GLint maxTexelCount = 0; // Of a buffer texture
+    vector<PointLight> lights;
+    bool areLightsDirty = false;
+
+    GLuint ubo = 0;
+    GLuint lightBuffer = 0, lightTexture = 0;
+    GLuint clusterBuffer = 0, clusterTexture = 0;
+    GLuint indexBuffer = 0, indexTexture = 0;
+    GLsizeiptr indexBufferSize = 0;
+
+    vector<LightRange> lightRanges;
+    vector<vector<GLuint>> sliceIndices; // Light indices of each slice, cluster after cluster
+    vector<uvec2> clusters; // First index & count
+    vector<GLuint> indices;
+    ClusteredLightsStats stats;
+
+    int getSlice(float depth, float sliceScale, float sliceBias) const;
+
+    void uploadLights();
+};
+
+#endif //GC_CLUSTEREDLIGHTS_H
@@ -0,0 +1,35 @@
+#include "DrawTable.h"
+
+void DrawTable::setRanges(const vector<DrawRange> &drawRanges) {
+    ranges = drawRanges;
+    visibility.assign(ranges.size(), true);
+    variants.assign(ranges.size(), 0);
+}
+
+const vector<DrawRange> &DrawTable::getRanges() const {
+    return ranges;
+}
+
+size_t DrawTable::getRangeCount() const {
+    return ranges.size();
+}
+
+void DrawTable::setVisible(size_t range, bool isVisible) {
+    visibility[range] = isVisible;
+}
+
+void DrawTable::setAllVisible(bool isVisible) {
+    visibility.assign(ranges.size(), isVisible);
+}
+
+bool DrawTable::isVisible(size_t range) const {
+    return visibility[range];
+}
+
+void DrawTable::setVariant(size_t range, GLuint variant) {
+    variants[range] = variant;
+}
+
+GLuint DrawTable::getVariant(size_t range) const {
+    return variants[range];
+}
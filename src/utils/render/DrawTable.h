@@ -0,0 +1,47 @@
+#ifndef GC_DRAWTABLE_H
+#define GC_DRAWTABLE_H
+
+#include <GL/glew.h>
+#include <glm/glm.hpp>
+#include <vector>
+#include "../culling/AABB.h"
+
+using namespace std;
+using namespace glm;
+
+// A contiguous run of indices belonging to one submesh
+struct DrawRange {
+    GLuint indexOffset; // In indices, not bytes
+    GLsizei indexCount;
+    GLint baseVertex;
+    AABB bounds;
+};
+
+// Per-submesh draw ranges into a shared vertex/index buffer pair, each with its visibility and the shader variant
+// drawing it. The visible ranges are submitted to the RenderQueue, which sorts and batches them.
+class DrawTable {
+public:
+    void setRanges(const vector<DrawRange> &drawRanges);
+
+    const vector<DrawRange> &getRanges() const;
+
+    size_t getRangeCount() const;
+
+    void setVisible(size_t range, bool isVisible);
+
+    void setAllVisible(bool isVisible);
+
+    bool isVisible(size_t range) const;
+
+    // Ranges start out with variant 0
+    void setVariant(size_t range, GLuint variant);
+
+    GLuint getVariant(size_t range) const;
+
+private:
+    vector<DrawRange> ranges;
+    vector<bool> visibility;
+    vector<GLuint> variants;
+};
+
+#endif //GC_DRAWTABLE_H
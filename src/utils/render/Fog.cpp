@@ -0,0 +1,13 @@
+#include "Fog.h"
+
+float Fog::getVisibility(float depth) const {
+    return clamp(exp(-pow(depth * density, gradient)), 0.0f, 1.0f);
+}
+
+float Fog::getFullyFoggedDepth() const {
+    return pow(-log(INVISIBLE_VISIBILITY), 1.0f / gradient) / density;
+}
+
+vec4 Fog::getShaderParameters() const {
+    return vec4(density, gradient, 0.0f, 0.0f);
+}
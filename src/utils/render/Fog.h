@@ -0,0 +1,27 @@
+#ifndef GC_FOG_H
+#define GC_FOG_H
+
+#include <glm/glm.hpp>
+
+using namespace glm;
+
+// Exponential fog on the view depth, visibility = exp(-(depth * density)^gradient). The shaders get the same
+// parameters through FrameConstants and evaluate it per fragment, so anything the CPU finds fully fogged is
+// invisible on screen too.
+struct Fog {
+    // Less than half a step of an 8 bit channel, only the sky color is left
+    static constexpr float INVISIBLE_VISIBILITY = 0.5f / 255.0f;
+
+    float density;
+    float gradient;
+
+    float getVisibility(float depth) const;
+
+    // Depth from which everything is fully fogged
+    float getFullyFoggedDepth() const;
+
+    // x = density, y = gradient, as read by the shaders
+    vec4 getShaderParameters() const;
+};
+
+#endif //GC_FOG_H
@@ -0,0 +1,40 @@
+#include "FrameConstants.h"
+#include <cstring>
+
+void FrameConstants::initialize() {
+    glGenBuffers(1, &ubo);
+    glBindBuffer(GL_UNIFORM_BUFFER, ubo);
+    glBufferData(GL_UNIFORM_BUFFER, sizeof(FrameConstantsData), nullptr, GL_DYNAMIC_DRAW);
+    glBindBuffer(GL_UNIFORM_BUFFER, 0);
+
+    glBindBufferBase(GL_UNIFORM_BUFFER, BINDING, ubo);
+}
+
+void FrameConstants::bindProgram(GLuint program) {
+    const auto blockIndex = glGetUniformBlockIndex(program, "FrameConstants");
+    if (blockIndex != GL_INVALID_INDEX) {
+        glUniformBlockBinding(program, blockIndex, BINDING);
+    }
+}
+
+void FrameConstants::update(const FrameConstantsData &data) {
+    if (hasUploadedData && memcmp(&data, &uploadedData, sizeof(FrameConstantsData)) == 0) {
+        return;
+    }
+
+    glBindBuffer(GL_UNIFORM_BUFFER, ubo);
+    glBufferSubData(GL_UNIFORM_BUFFER, 0, sizeof(FrameConstantsData), &data);
+    glBindBuffer(GL_UNIFORM_BUFFER, 0);
+
+    uploadedData = data;
+    hasUploadedData = true;
+    uploadCount++;
+}
+
+size_t FrameConstants::getUploadCount() const {
+    return uploadCount;
+}
+
+void FrameConstants::cleanUp() {
+    glDeleteBuffers(1, &ubo);
+}
@@ -0,0 +1,46 @@
+#ifndef GC_FRAMECONSTANTS_H
+#define GC_FRAMECONSTANTS_H
+
+#include <GL/glew.h>
+#include <glm/glm.hpp>
+
+using namespace glm;
+
+// Mirrors the std140 FrameConstants block in the shaders - vec3s are padded to vec4
+struct FrameConstantsData {
+    mat4 viewProjection;
+    vec4 cameraPosition;
+    // Light & camera positions already multiplied by viewProjection, as the shaders light in that space
+    vec4 lightPosition;
+    vec4 viewPosition;
+    vec4 lightColor;
+    vec4 skyColor;
+    vec4 fog; // x = density, y = gradient
+};
+
+static_assert(sizeof(FrameConstantsData) == 64 + 6 * 16, "FrameConstantsData must match the std140 layout");
+
+// Per-frame constants shared by every program through a uniform buffer, uploaded only when they change
+class FrameConstants {
+public:
+    static const GLuint BINDING = 0;
+
+    void initialize();
+
+    // Points the program's FrameConstants block at the shared buffer
+    static void bindProgram(GLuint program);
+
+    void update(const FrameConstantsData &data);
+
+    size_t getUploadCount() const;
+
+    void cleanUp();
+
+private:
+    GLuint ubo = 0;
+    FrameConstantsData uploadedData{};
+    bool hasUploadedData = false;
+    size_t uploadCount = 0;
+};
+
+#endif //GC_FRAMECONSTANTS_H
@@ -0,0 +1,161 @@
+#include "HeadlessContext.h"
+#include <fstream>
+#include <vector>
+
+#ifdef GC_HAS_EGL
+#include <EGL/egl.h>
+#include <EGL/eglext.h>
+#endif
+
+bool HeadlessContext::create(int width, int height) {
+    this->width = width;
+    this->height = height;
+
+#ifdef GC_HAS_EGL
+    // Display - surfaceless Mesa first, then whatever the default display is
+    EGLDisplay eglDisplay = EGL_NO_DISPLAY;
+    auto getPlatformDisplay = (PFNEGLGETPLATFORMDISPLAYEXTPROC) eglGetProcAddress("eglGetPlatformDisplayEXT");
+    if (getPlatformDisplay) {
+        eglDisplay = getPlatformDisplay(EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY, nullptr);
+    }
+    if (eglDisplay == EGL_NO_DISPLAY) {
+        eglDisplay = eglGetDisplay(EGL_DEFAULT_DISPLAY);
+    }
+
+    EGLint major, minor;
+    if (eglDisplay == EGL_NO_DISPLAY || !eglInitialize(eglDisplay, &major, &minor)) {
+        cout << "ERROR::HEADLESS::EGL_INITIALIZATION_FAILED" << endl;
+        return false;
+    }
+    display = eglDisplay;
+
+    // Config - a pbuffer one if available, the surfaceless platform only offers configs without surfaces
+    const EGLint pbufferConfigAttributes[] = {
+            EGL_SURFACE_TYPE, EGL_PBUFFER_BIT,
+            EGL_RENDERABLE_TYPE, EGL_OPENGL_BIT,
+            EGL_RED_SIZE, 8, EGL_GREEN_SIZE, 8, EGL_BLUE_SIZE, 8,
+            EGL_DEPTH_SIZE, 24,
+            EGL_NONE
+    };
+    const EGLint surfacelessConfigAttributes[] = {
+            EGL_SURFACE_TYPE, 0,
+            EGL_RENDERABLE_TYPE, EGL_OPENGL_BIT,
+            EGL_NONE
+    };
+    EGLConfig config;
+    EGLint configCount = 0;
+    auto hasPbuffer = eglChooseConfig(eglDisplay, pbufferConfigAttributes, &config, 1, &configCount) &&
+                      configCount > 0;
+    if (!hasPbuffer &&
+        (!eglChooseConfig(eglDisplay, surfacelessConfigAttributes, &config, 1, &configCount) || configCount == 0)) {
+        cout << "ERROR::HEADLESS::NO_EGL_CONFIG" << endl;
+        return false;
+    }
+
+    // Context
+    if (!eglBindAPI(EGL_OPENGL_API)) {
+        cout << "ERROR::HEADLESS::OPENGL_API_UNAVAILABLE" << endl;
+        return false;
+    }
+    const EGLint contextAttributes[] = {
+            EGL_CONTEXT_MAJOR_VERSION, 3,
+            EGL_CONTEXT_MINOR_VERSION, 3,
+            EGL_CONTEXT_OPENGL_PROFILE_MASK, EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT,
+            EGL_NONE
+    };
+    EGLContext eglContext = eglCreateContext(eglDisplay, config, EGL_NO_CONTEXT, contextAttributes);
+    if (eglContext == EGL_NO_CONTEXT) {
+        cout << "ERROR::HEADLESS::CONTEXT_CREATION_FAILED" << endl;
+        return false;
+    }
+    context = eglContext;
+
+    // Surface - everything is rendered into the framebuffer object, the pbuffer is only a fallback drawable
+    EGLSurface eglSurface = EGL_NO_SURFACE;
+    if (hasPbuffer) {
+        const EGLint pbufferAttributes[] = {EGL_WIDTH, width, EGL_HEIGHT, height, EGL_NONE};
+        eglSurface = eglCreatePbufferSurface(eglDisplay, config, pbufferAttributes);
+    }
+    surface = eglSurface;
+
+    if (!eglMakeCurrent(eglDisplay, eglSurface, eglSurface, eglContext)) {
+        cout << "ERROR::HEADLESS::MAKE_CURRENT_FAILED" << endl;
+        return false;
+    }
+
+    cout << "Headless: EGL " << major << "." << minor << (hasPbuffer ? ", pbuffer" : ", surfaceless") << endl;
+    return true;
+#else
+    cout << "ERROR::HEADLESS::BUILT_WITHOUT_EGL" << endl;
+    return false;
+#endif
+}
+
+bool HeadlessContext::createFramebuffer() {
+    glGenFramebuffers(1, &framebuffer);
+    glGenRenderbuffers(1, &colorRenderbuffer);
+    glGenRenderbuffers(1, &depthRenderbuffer);
+
+    glBindRenderbuffer(GL_RENDERBUFFER, colorRenderbuffer);
+    glRenderbufferStorage(GL_RENDERBUFFER, GL_RGBA8, width, height);
+    glBindRenderbuffer(GL_RENDERBUFFER, depthRenderbuffer);
+    glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH_COMPONENT24, width, height);
+    glBindRenderbuffer(GL_RENDERBUFFER, 0);
+
+    glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+    glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, colorRenderbuffer);
+    glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_RENDERBUFFER, depthRenderbuffer);
+
+    if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE) {
+        cout << "ERROR::HEADLESS::FRAMEBUFFER_INCOMPLETE" << endl;
+        return false;
+    }
+
+    return true;
+}
+
+void HeadlessContext::bindFramebuffer() const {
+    glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+}
+
+bool HeadlessContext::saveFramebuffer(const string &path) const {
+    vector<GLubyte> pixels(width * height * 3);
+    glBindFramebuffer(GL_READ_FRAMEBUFFER, framebuffer);
+    glPixelStorei(GL_PACK_ALIGNMENT, 1);
+    glReadPixels(0, 0, width, height, GL_RGB, GL_UNSIGNED_BYTE, &pixels[0]);
+
+    ofstream file(path, ios::binary);
+    if (!file) {
+        cout << "ERROR::HEADLESS::CANNOT_WRITE " << path << endl;
+        return false;
+    }
+
+    // PPM rows go top to bottom, GL rows bottom to top
+    file << "P6\n" << width << " " << height << "\n255\n";
+    for (auto row = height - 1; row >= 0; row--) {
+        file.write((const char *) &pixels[row * width * 3], width * 3);
+    }
+
+    return true;
+}
+
+void HeadlessContext::destroy() {
+    if (framebuffer) {
+        glDeleteFramebuffers(1, &framebuffer);
+        glDeleteRenderbuffers(1, &colorRenderbuffer);
+        glDeleteRenderbuffers(1, &depthRenderbuffer);
+    }
+
+#ifdef GC_HAS_EGL
+    if (display) {
+        eglMakeCurrent(display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+        if (surface) {
+            eglDestroySurface(display, surface);
+        }
+        if (context) {
+            eglDestroyContext(display, context);
+        }
+        eglTerminate(display);
+    }
+#endif
+}
@@ -0,0 +1,40 @@
+#ifndef GC_HEADLESSCONTEXT_H
+#define GC_HEADLESSCONTEXT_H
+
+#include <GL/glew.h>
+#include <iostream>
+#include <string>
+
+using namespace std;
+
+// An OpenGL 3.3 core context without a window. Created through EGL, preferring Mesa's surfaceless
+// platform so it also works on machines without a display server (e.g. llvmpipe). Frames are rendered
+// into an offscreen framebuffer object.
+class HeadlessContext {
+public:
+    // Creates the context and makes it current, before GLEW is initialized
+    bool create(int width, int height);
+
+    // Needs the GL entry points, call after glewInit()
+    bool createFramebuffer();
+
+    void bindFramebuffer() const;
+
+    // Writes the color attachment as a binary PPM
+    bool saveFramebuffer(const string &path) const;
+
+    void destroy();
+
+private:
+    int width = 0, height = 0;
+
+    void *display = nullptr;
+    void *surface = nullptr;
+    void *context = nullptr;
+
+    GLuint framebuffer = 0;
+    GLuint colorRenderbuffer = 0;
+    GLuint depthRenderbuffer = 0;
+};
+
+#endif //GC_HEADLESSCONTEXT_H
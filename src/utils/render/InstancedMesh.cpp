@@ -0,0 +1,308 @@
+#include "InstancedMesh.h"
+
+void InstancedMesh::initialize(const pmr::vector<PackedVertex> &vertices, const pmr::vector<GLuint> &indices) {
+    initialize(vertices, indices, {DrawRange{0, (GLsizei) indices.size(), 0, AABB()}});
+}
+
+void InstancedMesh::initialize(const pmr::vector<PackedVertex> &vertices, const pmr::vector<GLuint> &indices,
+                               const vector<DrawRange> &lodRanges) {
+    initialize(vertices.data(), vertices.size(), indices.data(), indices.size(), lodRanges);
+}
+
+void InstancedMesh::initialize(const PackedVertex *vertices, size_t vertexCount, const GLuint *indices,
+                               size_t indexCount, const vector<DrawRange> &lodRanges) {
+    this->vertexCount = (GLsizei) vertexCount;
+    lods = lodRanges;
+    visibleLodCounts.assign(lods.size(), 0);
+
+    glGenVertexArrays(1, &vao);
+    glGenBuffers(1, &vbo);
+    glGenBuffers(1, &ebo);
+    glGenBuffers(1, &instanceVbo);
+    glGenBuffers(1, &passInstanceVbo);
+
+    glBindVertexArray(vao);
+
+    // Mesh
+    glBindBuffer(GL_ARRAY_BUFFER, vbo);
+    glBufferData(GL_ARRAY_BUFFER, vertexCount * sizeof(PackedVertex), vertices, GL_STATIC_DRAW);
+    VertexFormat::enableInterleavedAttributes();
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, ebo);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, indexCount * sizeof(GLuint), indices, GL_STATIC_DRAW);
+
+    // Instances
+    glEnableVertexAttribArray(4); // 4 = position & scale
+    glVertexAttribDivisor(4, 1);
+    glEnableVertexAttribArray(5); // 5 = rotation
+    glVertexAttribDivisor(5, 1);
+    glEnableVertexAttribArray(6); // 6 = tint
+    glVertexAttribDivisor(6, 1);
+    bindInstanceAttributes(instanceVbo, 0);
+
+    glBindVertexArray(0);
+}
+
+void InstancedMesh::bindInstanceAttributes(GLuint buffer, size_t firstInstance) {
+    // Without base instance support (GL 4.2) the first instance is selected through the attribute offsets
+    const auto stride = sizeof(MeshInstance);
+    const auto offset = firstInstance * stride;
+    glBindBuffer(GL_ARRAY_BUFFER, buffer);
+    glVertexAttribPointer(4, 4, GL_FLOAT, GL_FALSE, stride, (GLvoid *) (offset + offsetof(MeshInstance, position)));
+    glVertexAttribPointer(5, 1, GL_FLOAT, GL_FALSE, stride, (GLvoid *) (offset + offsetof(MeshInstance, rotation)));
+    glVertexAttribPointer(6, 4, GL_UNSIGNED_BYTE, GL_TRUE, stride, (GLvoid *) (offset + offsetof(MeshInstance, tint)));
+}
+
+InstancedMesh::InstanceHandle InstancedMesh::addInstance(const MeshInstance &instance) {
+    InstanceHandle handle;
+    if (!freeHandles.empty()) {
+        handle = freeHandles.back();
+        freeHandles.pop_back();
+    } else {
+        handle = (InstanceHandle) handleSlots.size();
+        handleSlots.push_back(INVALID_SLOT);
+    }
+
+    handleSlots[handle] = (GLuint) instances.size();
+    instances.push_back(instance);
+    slotHandles.push_back(handle);
+    isInstanceBufferDirty = true;
+    instanceVersion++;
+
+    return handle;
+}
+
+void InstancedMesh::updateInstance(InstanceHandle handle, const MeshInstance &instance) {
+    if (handle >= handleSlots.size() || handleSlots[handle] == INVALID_SLOT) {
+        cout << "ERROR::INSTANCED_MESH::INVALID_HANDLE " << handle << endl;
+        return;
+    }
+
+    instances[handleSlots[handle]] = instance;
+    isInstanceBufferDirty = true;
+    instanceVersion++;
+}
+
+void InstancedMesh::removeInstance(InstanceHandle handle) {
+    if (handle >= handleSlots.size() || handleSlots[handle] == INVALID_SLOT) {
+        cout << "ERROR::INSTANCED_MESH::INVALID_HANDLE " << handle << endl;
+        return;
+    }
+
+    // Swap with the last instance so the buffer stays contiguous
+    const auto slot = handleSlots[handle];
+    const auto lastSlot = (GLuint) instances.size() - 1;
+    if (slot != lastSlot) {
+        instances[slot] = instances[lastSlot];
+        slotHandles[slot] = slotHandles[lastSlot];
+        handleSlots[slotHandles[slot]] = slot;
+    }
+    instances.pop_back();
+    slotHandles.pop_back();
+
+    handleSlots[handle] = INVALID_SLOT;
+    freeHandles.push_back(handle);
+    isInstanceBufferDirty = true;
+    instanceVersion++;
+}
+
+void InstancedMesh::clearInstances() {
+    instances.clear();
+    slotHandles.clear();
+    handleSlots.clear();
+    freeHandles.clear();
+    visibleHandlesByLod.clear();
+    isInstanceBufferDirty = true;
+    instanceVersion++;
+}
+
+size_t InstancedMesh::getInstanceCount() const {
+    return instances.size();
+}
+
+uint64_t InstancedMesh::getInstanceVersion() const {
+    return instanceVersion;
+}
+
+const MeshInstance &InstancedMesh::getInstanceAt(size_t slot) const {
+    return instances[slot];
+}
+
+InstancedMesh::InstanceHandle InstancedMesh::getHandleAt(size_t slot) const {
+    return slotHandles[slot];
+}
+
+void InstancedMesh::setVisibleInstances(const vector<InstanceHandle> &handles) {
+    setVisibleInstances(vector<vector<InstanceHandle>>{handles});
+}
+
+void InstancedMesh::setVisibleInstances(const vector<vector<InstanceHandle>> &handlesByLod) {
+    if (isFilteringVisible && handlesByLod == visibleHandlesByLod) {
+        return;
+    }
+
+    if (handlesByLod.size() > lods.size()) {
+        cout << "ERROR::INSTANCED_MESH::INVALID_LOD " << handlesByLod.size() - 1 << endl;
+        return;
+    }
+
+    isFilteringVisible = true;
+    visibleHandlesByLod = handlesByLod;
+    isInstanceBufferDirty = true;
+}
+
+void InstancedMesh::showAllInstances() {
+    if (!isFilteringVisible) {
+        return;
+    }
+
+    isFilteringVisible = false;
+    visibleHandlesByLod.clear();
+    isInstanceBufferDirty = true;
+}
+
+size_t InstancedMesh::getDrawnInstanceCount() const {
+    return isFilteringVisible ? visibleInstances.size() : instances.size();
+}
+
+size_t InstancedMesh::getVertexCount() const {
+    return vertexCount;
+}
+
+size_t InstancedMesh::getIndexCount(size_t lod) const {
+    return lods[lod].indexCount;
+}
+
+size_t InstancedMesh::getLodCount() const {
+    return lods.size();
+}
+
+const DrawRange &InstancedMesh::getLod(size_t lod) const {
+    return lods[lod];
+}
+
+size_t InstancedMesh::getDrawnTriangleCount() const {
+    if (!isFilteringVisible) {
+        return instances.size() * lods[0].indexCount / 3;
+    }
+
+    size_t triangleCount = 0;
+    for (auto lod = 0; lod < lods.size(); lod++) {
+        triangleCount += visibleLodCounts[lod] * lods[lod].indexCount / 3;
+    }
+    return triangleCount;
+}
+
+void InstancedMesh::uploadInstances() {
+    // Gather the visible instances grouped by level of detail, skipping handles removed since they were set
+    if (isFilteringVisible) {
+        visibleInstances.clear();
+        visibleLodCounts.assign(lods.size(), 0);
+        for (auto lod = 0; lod < visibleHandlesByLod.size(); lod++) {
+            for (const auto handle: visibleHandlesByLod[lod]) {
+                if (handle < handleSlots.size() && handleSlots[handle] != INVALID_SLOT) {
+                    visibleInstances.push_back(instances[handleSlots[handle]]);
+                    visibleLodCounts[lod]++;
+                }
+            }
+        }
+    }
+    uploadInstanceBuffer(instanceVbo, instanceCapacity, isFilteringVisible ? visibleInstances : instances);
+
+    isInstanceBufferDirty = false;
+}
+
+void InstancedMesh::uploadInstanceBuffer(GLuint buffer, size_t &capacity, const vector<MeshInstance> &uploaded) {
+    glBindBuffer(GL_ARRAY_BUFFER, buffer);
+    if (uploaded.size() > capacity) {
+        // Grow geometrically so adding instances one at a time doesn't reallocate every frame
+        capacity = std::max(uploaded.size(), 2 * capacity);
+    }
+    // Orphan the old storage so the driver doesn't wait on frames still using it
+    glBufferData(GL_ARRAY_BUFFER, capacity * sizeof(MeshInstance), nullptr, GL_DYNAMIC_DRAW);
+    if (!uploaded.empty()) {
+        glBufferSubData(GL_ARRAY_BUFFER, 0, uploaded.size() * sizeof(MeshInstance), &uploaded[0]);
+    }
+}
+
+GLsizei InstancedMesh::getDrawnInstanceCount(size_t lod) const {
+    if (!isFilteringVisible) {
+        return lod == 0 ? (GLsizei) instances.size() : 0;
+    }
+    return lod < visibleLodCounts.size() ? visibleLodCounts[lod] : 0;
+}
+
+void InstancedMesh::prepare() {
+    if (isInstanceBufferDirty) {
+        uploadInstances();
+    }
+}
+
+void InstancedMesh::drawLod(size_t lod) {
+    prepare();
+    const auto instanceCount = getDrawnInstanceCount(lod);
+    if (instanceCount == 0) {
+        return;
+    }
+
+    size_t firstInstance = 0;
+    for (auto i = 0; i < lod; i++) {
+        firstInstance += getDrawnInstanceCount(i);
+    }
+
+    glBindVertexArray(vao);
+    bindInstanceAttributes(instanceVbo, firstInstance);
+    glDrawElementsInstancedBaseVertex(
+            GL_TRIANGLES, lods[lod].indexCount, GL_UNSIGNED_INT,
+            (GLvoid *) (lods[lod].indexOffset * sizeof(GLuint)), instanceCount, lods[lod].baseVertex
+    );
+}
+
+void InstancedMesh::drawInstances(const vector<InstanceHandle> &handles, size_t lod) {
+    passInstances.clear();
+    for (const auto handle: handles) {
+        if (handle < handleSlots.size() && handleSlots[handle] != INVALID_SLOT) {
+            passInstances.push_back(instances[handleSlots[handle]]);
+        }
+    }
+    drawInstances(passInstances, lod);
+}
+
+void InstancedMesh::drawInstances(const vector<MeshInstance> &drawnInstances, size_t lod) {
+    if (drawnInstances.empty()) {
+        return;
+    }
+
+    uploadInstanceBuffer(passInstanceVbo, passInstanceCapacity, drawnInstances);
+    glBindVertexArray(vao);
+    bindInstanceAttributes(passInstanceVbo, 0);
+    glDrawElementsInstancedBaseVertex(
+            GL_TRIANGLES, lods[lod].indexCount, GL_UNSIGNED_INT,
+            (GLvoid *) (lods[lod].indexOffset * sizeof(GLuint)), (GLsizei) drawnInstances.size(), lods[lod].baseVertex
+    );
+}
+
+void InstancedMesh::cleanUp() {
+    glDeleteBuffers(1, &passInstanceVbo);
+    glDeleteBuffers(1, &instanceVbo);
+    glDeleteBuffers(1, &ebo);
+    glDeleteBuffers(1, &vbo);
+    glDeleteVertexArrays(1, &vao);
+}
+
+MeshInstance InstancedMesh::makeInstance(vec3 position, float scale, float rotation, vec3 tint) {
+    MeshInstance instance{};
+    instance.position = position;
+    instance.scale = scale;
+    instance.rotation = rotation;
+    instance.tint[0] = (GLubyte) (glm::clamp(tint.r, 0.0f, 1.0f) * 255.0f + 0.5f);
+    instance.tint[1] = (GLubyte) (glm::clamp(tint.g, 0.0f, 1.0f) * 255.0f + 0.5f);
+    instance.tint[2] = (GLubyte) (glm::clamp(tint.b, 0.0f, 1.0f) * 255.0f + 0.5f);
+    instance.tint[3] = 255;
+    return instance;
+}
+
+void InstancedMesh::setDefaultInstanceAttributes() {
+    glVertexAttrib4f(4, 0.0f, 0.0f, 0.0f, 1.0f);
+    glVertexAttrib1f(5, 0.0f);
+    glVertexAttrib4f(6, 1.0f, 1.0f, 1.0f, 1.0f);
+}
@@ -0,0 +1,136 @@
+#ifndef GC_INSTANCEDMESH_H
+#define GC_INSTANCEDMESH_H
+
+#include <GL/glew.h>
+#include <glm/glm.hpp>
+#include <vector>
+#include <cstdint>
+#include <memory_resource>
+#include <iostream>
+#include "VertexFormat.h"
+#include "DrawTable.h"
+
+using namespace std;
+using namespace glm;
+
+struct MeshInstance {
+    vec3 position;
+    float scale;
+    float rotation; // Around the Y axis, in radians
+    GLubyte tint[4]; // RGBA8, normalized
+};
+
+static_assert(sizeof(MeshInstance) == 24, "MeshInstance must stay tightly packed");
+
+// A single mesh drawn many times with glDrawElementsInstanced. Per-instance data lives in its own
+// buffer (attribute locations 4-6) and is re-uploaded only after instances were added, updated or removed.
+// The mesh may hold several levels of detail, one draw range each, finest first.
+class InstancedMesh {
+public:
+    typedef GLuint InstanceHandle;
+
+    void initialize(const pmr::vector<PackedVertex> &vertices, const pmr::vector<GLuint> &indices);
+
+    void initialize(const pmr::vector<PackedVertex> &vertices, const pmr::vector<GLuint> &indices,
+                    const vector<DrawRange> &lodRanges);
+
+    void initialize(const PackedVertex *vertices, size_t vertexCount, const GLuint *indices, size_t indexCount,
+                    const vector<DrawRange> &lodRanges);
+
+    InstanceHandle addInstance(const MeshInstance &instance);
+
+    void updateInstance(InstanceHandle handle, const MeshInstance &instance);
+
+    void removeInstance(InstanceHandle handle);
+
+    void clearInstances();
+
+    size_t getInstanceCount() const;
+
+    // Changes whenever instances are added, updated or removed, so data derived from them can tell it is stale
+    uint64_t getInstanceVersion() const;
+
+    // Instances are stored densely, slots are invalidated by removeInstance
+    const MeshInstance &getInstanceAt(size_t slot) const;
+
+    InstanceHandle getHandleAt(size_t slot) const;
+
+    // Only the given instances are drawn (at the finest level) until showAllInstances() is called
+    void setVisibleInstances(const vector<InstanceHandle> &handles);
+
+    // Same as above, handlesByLod[i] are drawn with level of detail i
+    void setVisibleInstances(const vector<vector<InstanceHandle>> &handlesByLod);
+
+    void showAllInstances();
+
+    size_t getDrawnInstanceCount() const;
+
+    size_t getVertexCount() const;
+
+    size_t getIndexCount(size_t lod = 0) const;
+
+    size_t getLodCount() const;
+
+    const DrawRange &getLod(size_t lod) const;
+
+    size_t getDrawnTriangleCount() const;
+
+    // Visible instances at the given level of detail, after uploadInstances()
+    GLsizei getDrawnInstanceCount(size_t lod) const;
+
+    // Uploads the instances if they changed since the last upload
+    void prepare();
+
+    // Draws one level of detail and leaves the mesh's VAO bound, for callers ordering the levels themselves
+    void drawLod(size_t lod);
+
+    // Draws the given instances at one level of detail from a buffer of their own, leaving the visible instances and
+    // their buffer alone - for passes seeing other instances than the camera, like the shadows. Leaves the VAO bound.
+    void drawInstances(const vector<InstanceHandle> &handles, size_t lod);
+
+    // Same, for instances not stored in the mesh
+    void drawInstances(const vector<MeshInstance> &drawnInstances, size_t lod);
+
+    void cleanUp();
+
+    static MeshInstance makeInstance(vec3 position, float scale = 1.0f, float rotation = 0.0f,
+                                     vec3 tint = vec3(1.0f));
+
+    // Values seen by the instance attributes when drawing without an instance buffer
+    static void setDefaultInstanceAttributes();
+
+private:
+    static const GLuint INVALID_SLOT = 0xFFFFFFFFu;
+
+    GLuint vao = 0, vbo = 0, ebo = 0, instanceVbo = 0, passInstanceVbo = 0;
+    GLsizei vertexCount = 0;
+    vector<DrawRange> lods;
+
+    vector<MeshInstance> instances;
+    // instances[i] belongs to slotHandles[i]; handleSlots[handle] is the index into instances
+    vector<InstanceHandle> slotHandles;
+    vector<GLuint> handleSlots;
+    vector<InstanceHandle> freeHandles;
+    uint64_t instanceVersion = 0;
+
+    size_t instanceCapacity = 0;
+    bool isInstanceBufferDirty = false;
+
+    bool isFilteringVisible = false;
+    vector<vector<InstanceHandle>> visibleHandlesByLod;
+    vector<MeshInstance> visibleInstances;
+    // Number of uploaded instances per level of detail, stored back to back in the instance buffer
+    vector<GLsizei> visibleLodCounts;
+
+    // Instances of drawInstances(), rewritten by every call
+    size_t passInstanceCapacity = 0;
+    vector<MeshInstance> passInstances;
+
+    void uploadInstances();
+
+    static void uploadInstanceBuffer(GLuint buffer, size_t &capacity, const vector<MeshInstance> &uploaded);
+
+    void bindInstanceAttributes(GLuint buffer, size_t firstInstance);
+};
+
+#endif //GC_INSTANCEDMESH_H
@@ -0,0 +1,81 @@
+#include "MaterialTable.h"
+#include <iostream>
+
+GLubyte MaterialTable::getId(const Material &material) {
+    lock_guard<mutex> guard(lock);
+
+    for (auto i = 0; i < materials.size(); i++) {
+        if (materials[i] == material) {
+            return (GLubyte) i;
+        }
+    }
+
+    if (materials.size() == MAX_MATERIALS) {
+        cout << "ERROR::MATERIALS::TOO_MANY_MATERIALS" << endl;
+        exit(EXIT_FAILURE);
+    }
+    materials.push_back(material);
+    isDirty = true;
+    return (GLubyte) (materials.size() - 1);
+}
+
+const Material &MaterialTable::get(GLubyte id) const {
+    return materials[id];
+}
+
+void MaterialTable::set(GLubyte id, const Material &material) {
+    materials[id] = material;
+    isDirty = true;
+}
+
+void MaterialTable::setAll(const vector<Material> &materials) {
+    this->materials = materials;
+    isDirty = true;
+}
+
+const vector<Material> &MaterialTable::getAll() const {
+    return materials;
+}
+
+size_t MaterialTable::getCount() const {
+    return materials.size();
+}
+
+void MaterialTable::initialize() {
+    glGenBuffers(1, &ubo);
+    glBindBuffer(GL_UNIFORM_BUFFER, ubo);
+    glBufferData(GL_UNIFORM_BUFFER, MAX_MATERIALS * sizeof(MaterialData), nullptr, GL_DYNAMIC_DRAW);
+    glBindBuffer(GL_UNIFORM_BUFFER, 0);
+
+    glBindBufferBase(GL_UNIFORM_BUFFER, BINDING, ubo);
+}
+
+void MaterialTable::bindProgram(GLuint program) {
+    const auto blockIndex = glGetUniformBlockIndex(program, "Materials");
+    if (blockIndex != GL_INVALID_INDEX) {
+        glUniformBlockBinding(program, blockIndex, BINDING);
+    }
+}
+
+void MaterialTable::upload() {
+    if (!isDirty || materials.empty()) {
+        return;
+    }
+
+    vector<MaterialData> data(materials.size());
+    for (auto i = 0; i < materials.size(); i++) {
+        data[i].color = vec4(materials[i].color, 1.0f);
+        data[i].parameters = vec4(materials[i].shininess, 0.0f, 0.0f, 0.0f);
+    }
+
+    // Only the used entries, the rest of the block is never indexed
+    glBindBuffer(GL_UNIFORM_BUFFER, ubo);
+    glBufferSubData(GL_UNIFORM_BUFFER, 0, (GLsizeiptr) (data.size() * sizeof(MaterialData)), &data[0]);
+    glBindBuffer(GL_UNIFORM_BUFFER, 0);
+    isDirty = false;
+}
+
+void MaterialTable::cleanUp() {
+    glDeleteBuffers(1, &ubo);
+    ubo = 0;
+}
@@ -0,0 +1,61 @@
+#ifndef GC_MATERIALTABLE_H
+#define GC_MATERIALTABLE_H
+
+#include <GL/glew.h>
+#include <glm/glm.hpp>
+#include <mutex>
+#include <vector>
+#include "../color/Material.h"
+
+using namespace std;
+using namespace glm;
+
+// Mirrors one entry of the std140 Materials block in shader.vert
+struct MaterialData {
+    vec4 color; // rgb, a unused
+    vec4 parameters; // x = shininess, the rest is reserved
+};
+
+static_assert(sizeof(MaterialData) == 32, "MaterialData must match the std140 layout");
+
+// Materials referenced by index from the vertices and stored in a uniform buffer shared by every program,
+// so a material can change without touching the geometry
+class MaterialTable {
+public:
+    static const GLuint BINDING = 1;
+    // Must match MAX_MATERIALS in shader.vert, vertices store the index in a byte
+    static const int MAX_MATERIALS = 256;
+
+    // Registers the material on first use, safe to call from the generation jobs
+    GLubyte getId(const Material &material);
+
+    const Material &get(GLubyte id) const;
+
+    // Changes are uploaded by the next upload()
+    void set(GLubyte id, const Material &material);
+
+    // Replaces the whole table, e.g. with the one a cached scene was built with
+    void setAll(const vector<Material> &materials);
+
+    const vector<Material> &getAll() const;
+
+    size_t getCount() const;
+
+    void initialize();
+
+    // Points the program's Materials block at the shared buffer
+    static void bindProgram(GLuint program);
+
+    // Only uploads after a change
+    void upload();
+
+    void cleanUp();
+
+private:
+    mutex lock;
+    vector<Material> materials;
+    GLuint ubo = 0;
+    bool isDirty = true;
+};
+
+#endif //GC_MATERIALTABLE_H
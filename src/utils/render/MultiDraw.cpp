@@ -0,0 +1,40 @@
+#include "MultiDraw.h"
+
+void MultiDraw::add(GLuint indexOffset, GLsizei indexCount, GLint baseVertex) {
+    if (indexCount == 0) {
+        return;
+    }
+
+    const auto offset = (const GLvoid *) (indexOffset * sizeof(GLuint));
+    if (!counts.empty() && baseVertices.back() == baseVertex &&
+        (const GLubyte *) offsets.back() + counts.back() * sizeof(GLuint) == offset) {
+        counts.back() += indexCount;
+        return;
+    }
+    counts.push_back(indexCount);
+    offsets.push_back(offset);
+    baseVertices.push_back(baseVertex);
+}
+
+size_t MultiDraw::flush() {
+    const auto drawCount = counts.size();
+    if (drawCount == 0) {
+        return 0;
+    }
+
+    if (glMultiDrawElementsBaseVertex) {
+        glMultiDrawElementsBaseVertex(
+                GL_TRIANGLES, &counts[0], GL_UNSIGNED_INT,
+                &offsets[0], (GLsizei) drawCount, &baseVertices[0]
+        );
+    } else {
+        for (auto i = 0; i < drawCount; i++) {
+            glDrawElementsBaseVertex(GL_TRIANGLES, counts[i], GL_UNSIGNED_INT, (GLvoid *) offsets[i], baseVertices[i]);
+        }
+    }
+
+    counts.clear();
+    offsets.clear();
+    baseVertices.clear();
+    return drawCount;
+}
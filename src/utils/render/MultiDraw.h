@@ -0,0 +1,25 @@
+#ifndef GC_MULTIDRAW_H
+#define GC_MULTIDRAW_H
+
+#include <GL/glew.h>
+#include <vector>
+
+using namespace std;
+
+// Index ranges of the bound VAO gathered into a single glMultiDrawElementsBaseVertex (or a loop when unavailable).
+// A range directly following the previous one in the index buffer, with the same base vertex, extends it instead.
+class MultiDraw {
+public:
+    void add(GLuint indexOffset, GLsizei indexCount, GLint baseVertex);
+
+    // Draws the gathered ranges and starts over, returns the number of draws after merging
+    size_t flush();
+
+private:
+    // Kept around to avoid per-frame allocations
+    vector<GLsizei> counts;
+    vector<const GLvoid *> offsets;
+    vector<GLint> baseVertices;
+};
+
+#endif //GC_MULTIDRAW_H
@@ -0,0 +1,102 @@
+#include "RenderQueue.h"
+#include "InstancedMesh.h"
+#include <algorithm>
+#include <cstring>
+
+uint64_t RenderQueue::makeKey(GLuint variant, GLuint mesh, GLubyte material, uint32_t distanceBits) {
+    return (uint64_t) (variant & 0xFFu) << 56 |
+           (uint64_t) (mesh & 0xFFu) << 48 |
+           (uint64_t) material << 40 |
+           distanceBits;
+}
+
+uint32_t RenderQueue::getDistanceBits(float distance) {
+    distance = std::max(distance, 0.0f);
+    uint32_t bits;
+    memcpy(&bits, &distance, sizeof bits);
+    return bits;
+}
+
+void RenderQueue::radixSort(vector<SortEntry> &entries, vector<SortEntry> &scratch) {
+    if (entries.size() < 2) {
+        return;
+    }
+
+    scratch.resize(entries.size());
+    for (auto shift = 0; shift < 64; shift += 8) {
+        size_t counts[256] = {};
+        for (const auto &entry: entries) {
+            counts[(entry.key >> shift) & 0xFFu]++;
+        }
+        if (counts[(entries[0].key >> shift) & 0xFFu] == entries.size()) {
+            continue;
+        }
+
+        size_t offset = 0;
+        for (auto &count: counts) {
+            const auto bucketSize = count;
+            count = offset;
+            offset += bucketSize;
+        }
+        for (const auto &entry: entries) {
+            scratch[counts[(entry.key >> shift) & 0xFFu]++] = entry;
+        }
+        entries.swap(scratch);
+    }
+}
+
+void RenderQueue::clear() {
+    items.clear();
+    entries.clear();
+}
+
+void RenderQueue::submit(uint64_t key, const DrawItem &item) {
+    entries.push_back(SortEntry{key, (GLuint) items.size()});
+    items.push_back(item);
+}
+
+void RenderQueue::sort() {
+    radixSort(entries, scratch);
+}
+
+void RenderQueue::execute() {
+    stats = RenderQueueStats();
+    stats.itemCount = entries.size();
+
+    GLuint boundProgram = 0, boundVao = 0;
+    for (const auto &entry: entries) {
+        const auto &item = items[entry.value];
+        if (item.program != boundProgram) {
+            stats.drawCount += batch.flush();
+            glUseProgram(item.program);
+            boundProgram = item.program;
+            stats.programChanges++;
+        }
+
+        if (item.instancedMesh != nullptr) {
+            stats.drawCount += batch.flush();
+            item.instancedMesh->drawLod(item.lod);
+            stats.drawCount++;
+            stats.vaoChanges++;
+            boundVao = 0; // The mesh binds its own
+            continue;
+        }
+
+        if (item.vao != boundVao) {
+            stats.drawCount += batch.flush();
+            glBindVertexArray(item.vao);
+            // Instanced draws leave the instance attributes undefined
+            InstancedMesh::setDefaultInstanceAttributes();
+            boundVao = item.vao;
+            stats.vaoChanges++;
+        }
+
+        batch.add(item.indexOffset, item.indexCount, item.baseVertex);
+    }
+    stats.drawCount += batch.flush();
+    glBindVertexArray(0);
+}
+
+const RenderQueueStats &RenderQueue::getStats() const {
+    return stats;
+}
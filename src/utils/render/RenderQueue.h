@@ -0,0 +1,72 @@
+#ifndef GC_RENDERQUEUE_H
+#define GC_RENDERQUEUE_H
+
+#include <GL/glew.h>
+#include <cstdint>
+#include <vector>
+#include "MultiDraw.h"
+
+class InstancedMesh;
+
+using namespace std;
+
+// A draw of indices from the bound VAO, or one level of detail of an instanced mesh
+struct DrawItem {
+    GLuint program;
+    GLuint vao;
+    GLuint indexOffset; // In indices, not bytes
+    GLsizei indexCount;
+    GLint baseVertex;
+    InstancedMesh *instancedMesh; // When set, the mesh draws its visible instances of level lod instead
+    GLuint lod;
+};
+
+struct RenderQueueStats {
+    size_t itemCount = 0;
+    size_t drawCount = 0; // After merging
+    size_t programChanges = 0;
+    size_t vaoChanges = 0;
+};
+
+// Draws submitted in any order, sorted by key and issued with as few state changes and draws as possible.
+// Consecutive items sharing program & VAO are gathered into one glMultiDrawElementsBaseVertex, with ranges that are
+// adjacent in the index buffer merged.
+class RenderQueue {
+public:
+    struct SortEntry {
+        uint64_t key;
+        GLuint value;
+    };
+
+    // Most significant first: shader variant, mesh, material, then distance (from getDistanceBits) so opaque draws
+    // go front to back
+    static uint64_t makeKey(GLuint variant, GLuint mesh, GLubyte material, uint32_t distanceBits);
+
+    // Bits of a non negative float, ordered like the float itself
+    static uint32_t getDistanceBits(float distance);
+
+    // Stable LSD radix sort on the key, a byte per pass, skipping bytes all keys share
+    static void radixSort(vector<SortEntry> &entries, vector<SortEntry> &scratch);
+
+    void clear();
+
+    void submit(uint64_t key, const DrawItem &item);
+
+    void sort();
+
+    void execute();
+
+    // Of the last execute()
+    const RenderQueueStats &getStats() const;
+
+private:
+    vector<DrawItem> items;
+    vector<SortEntry> entries;
+    vector<SortEntry> scratch;
+    RenderQueueStats stats;
+
+    // Items of the current program & VAO
+    MultiDraw batch;
+};
+
+#endif //GC_RENDERQUEUE_H
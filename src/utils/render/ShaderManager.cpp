@@ -0,0 +1,266 @@
+#include "ShaderManager.h"
+#include "ShadersUtils.h"
+#include "../cache/ProgramCache.h"
+#include <iostream>
+
+#ifdef __linux__
+#include <sys/inotify.h>
+#include <unistd.h>
+#include <climits>
+#endif
+
+bool ShaderManager::initialize(ProgramCache &programCache, const string &vertexPath, const string &fragPath,
+                               bool isHotReloadEnabled) {
+    this->programCache = &programCache;
+    this->vertexPath = vertexPath;
+    this->fragPath = fragPath;
+    this->isHotReloadEnabled = isHotReloadEnabled;
+    vertexSource = ShadersUtils::readFile(vertexPath.c_str());
+    fragSource = ShadersUtils::readFile(fragPath.c_str());
+
+    // Without any defines, so a broken default shows up as a failure here
+    const auto programId = programCache.loadProgram(vertexSource, fragSource);
+    if (!ShadersUtils::checkProgram(programId)) {
+        glDeleteProgram(programId);
+        return false;
+    }
+    const ShaderPermutation defaultPermutation;
+    variants.push_back(Variant{defaultPermutation, defaultPermutation.getKey(), programId, PendingProgram()});
+
+    isParallelCompileSupported = GLEW_KHR_parallel_shader_compile;
+    if (isParallelCompileSupported) {
+        // Let the driver pick the thread count
+        glMaxShaderCompilerThreadsKHR(0xFFFFFFFF);
+    }
+    if (isHotReloadEnabled) {
+        watchSources();
+    }
+    return true;
+}
+
+ShaderManager::VariantIndex ShaderManager::getVariant(const ShaderPermutation &permutation) {
+    const auto key = permutation.getKey();
+    for (auto i = 0; i < variants.size(); i++) {
+        if (variants[i].key == key) {
+            return i;
+        }
+    }
+
+    const auto defines = permutation.getDefines();
+    auto programId = programCache->loadProgram(ShadersUtils::injectDefines(vertexSource, defines),
+                                               ShadersUtils::injectDefines(fragSource, defines));
+    if (!ShadersUtils::checkProgram(programId)) {
+        cout << "ERROR::SHADER_MANAGER::VARIANT_FAILED " << permutation.getName() << endl;
+        glDeleteProgram(programId);
+        programId = 0;
+    }
+    variants.push_back(Variant{permutation.normalized(), key, programId, PendingProgram()});
+    return variants.size() - 1;
+}
+
+void ShaderManager::watchSources() {
+    const filesystem::path paths[2] = {vertexPath, fragPath};
+    error_code error;
+    for (auto i = 0; i < 2; i++) {
+        lastWriteTimes[i] = filesystem::last_write_time(paths[i], error);
+        watchedNames.push_back(paths[i].filename().string());
+    }
+
+#ifdef __linux__
+    // Directories are watched, not the files, as editors often save by replacing the file
+    inotifyDescriptor = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    if (inotifyDescriptor < 0) {
+        cout << "ERROR::SHADER_MANAGER::INOTIFY_UNAVAILABLE" << endl;
+        return;
+    }
+    for (const auto &path: paths) {
+        auto directory = path.parent_path().string();
+        if (directory.empty()) {
+            directory = ".";
+        }
+        // Watching the same directory twice returns the same descriptor
+        inotify_add_watch(inotifyDescriptor, directory.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO | IN_CREATE);
+    }
+#endif
+}
+
+bool ShaderManager::haveSourcesChanged() {
+    auto hasChanged = false;
+
+#ifdef __linux__
+    if (inotifyDescriptor >= 0) {
+        alignas(inotify_event) char buffer[4096];
+        ssize_t length;
+        while ((length = read(inotifyDescriptor, buffer, sizeof buffer)) > 0) {
+            for (auto offset = 0; offset < length;) {
+                const auto *event = reinterpret_cast<const inotify_event *>(buffer + offset);
+                if (event->len > 0) {
+                    for (const auto &name: watchedNames) {
+                        hasChanged |= name == event->name;
+                    }
+                }
+                offset += (int) (sizeof(inotify_event) + event->len);
+            }
+        }
+        return hasChanged;
+    }
+#endif
+
+    if (++framesSincePoll < POLL_FRAMES) {
+        return false;
+    }
+    framesSincePoll = 0;
+
+    const filesystem::path paths[2] = {vertexPath, fragPath};
+    error_code error;
+    for (auto i = 0; i < 2; i++) {
+        const auto writeTime = filesystem::last_write_time(paths[i], error);
+        if (!error && writeTime != lastWriteTimes[i]) {
+            lastWriteTimes[i] = writeTime;
+            hasChanged = true;
+        }
+    }
+    return hasChanged;
+}
+
+void ShaderManager::beginReload() {
+    const auto newVertexSource = ShadersUtils::readFile(vertexPath.c_str());
+    const auto newFragSource = ShadersUtils::readFile(fragPath.c_str());
+    if (newVertexSource.empty() || newFragSource.empty()) {
+        // Probably caught mid-save, the next write triggers another reload
+        return;
+    }
+    vertexSource = newVertexSource;
+    fragSource = newFragSource;
+
+    // No status queries here, they happen in finishReload(). Without KHR_parallel_shader_compile the driver may still
+    // compile in these calls, stalling this frame
+    for (auto &variant: variants) {
+        // The default variant is compiled without defines, like the unmodified sources
+        const auto defines = &variant == &variants[0] ? "" : variant.permutation.getDefines();
+        auto &pending = variant.pending;
+        pending.vertexShaderId = ShadersUtils::createShader(
+                GL_VERTEX_SHADER, ShadersUtils::injectDefines(vertexSource, defines));
+        pending.fragmentShaderId = ShadersUtils::createShader(
+                GL_FRAGMENT_SHADER, ShadersUtils::injectDefines(fragSource, defines));
+        pending.programId = ShadersUtils::createProgram(pending.vertexShaderId, pending.fragmentShaderId);
+    }
+    isReloadPending = true;
+    pendingFramesWaited = 0;
+}
+
+bool ShaderManager::isPendingComplete() {
+    pendingFramesWaited++;
+    if (!isParallelCompileSupported) {
+        // Nothing to poll, finishReload() blocks on whatever the driver hasn't finished yet
+        return pendingFramesWaited >= PENDING_FRAMES;
+    }
+
+    for (const auto &variant: variants) {
+        GLint isComplete = GL_FALSE;
+        glGetProgramiv(variant.pending.programId, GL_COMPLETION_STATUS_KHR, &isComplete);
+        if (isComplete != GL_TRUE) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void ShaderManager::finishReload() {
+    // All or nothing, so the variants never mix old and new sources
+    auto isEveryVariantLinked = true;
+    for (auto &variant: variants) {
+        const auto isVertexCompiled = ShadersUtils::checkShader(variant.pending.vertexShaderId, "VERTEX");
+        const auto isFragmentCompiled = ShadersUtils::checkShader(variant.pending.fragmentShaderId, "FRAGMENT");
+        if (!isVertexCompiled || !isFragmentCompiled || !ShadersUtils::checkProgram(variant.pending.programId)) {
+            isEveryVariantLinked = false;
+            break;
+        }
+    }
+
+    if (isEveryVariantLinked) {
+        for (auto &variant: variants) {
+            glDeleteProgram(variant.programId);
+            variant.programId = variant.pending.programId;
+            variant.pending.programId = 0;
+        }
+        reloadCount++;
+        cout << "Shaders: reloaded " << variants.size() << " variants after " << pendingFramesWaited << " frames"
+             << endl;
+    } else {
+        failedReloadCount++;
+        cout << "Shaders: reload failed, keeping the previous programs" << endl;
+    }
+
+    for (auto &variant: variants) {
+        deletePending(variant.pending);
+    }
+    isReloadPending = false;
+}
+
+void ShaderManager::deletePending(PendingProgram &pending) {
+    glDeleteShader(pending.vertexShaderId);
+    glDeleteShader(pending.fragmentShaderId);
+    glDeleteProgram(pending.programId);
+    pending = PendingProgram();
+}
+
+bool ShaderManager::update() {
+    if (!isHotReloadEnabled) {
+        return false;
+    }
+
+    isReloadRequested |= haveSourcesChanged();
+
+    if (isReloadPending) {
+        if (!isPendingComplete()) {
+            return false;
+        }
+        const auto previousReloadCount = reloadCount;
+        finishReload();
+        return reloadCount != previousReloadCount;
+    }
+
+    // Saves during a rebuild are picked up once it's done
+    if (isReloadRequested) {
+        isReloadRequested = false;
+        beginReload();
+    }
+    return false;
+}
+
+GLuint ShaderManager::getProgram(VariantIndex variant) const {
+    const auto programId = variants[variant].programId;
+    return programId != 0 ? programId : variants[0].programId;
+}
+
+const ShaderPermutation &ShaderManager::getPermutation(VariantIndex variant) const {
+    return variants[variant].permutation;
+}
+
+size_t ShaderManager::getVariantCount() const {
+    return variants.size();
+}
+
+int ShaderManager::getReloadCount() const {
+    return reloadCount;
+}
+
+int ShaderManager::getFailedReloadCount() const {
+    return failedReloadCount;
+}
+
+void ShaderManager::cleanUp() {
+    for (auto &variant: variants) {
+        deletePending(variant.pending);
+        glDeleteProgram(variant.programId);
+    }
+    variants.clear();
+
+#ifdef __linux__
+    if (inotifyDescriptor >= 0) {
+        close(inotifyDescriptor);
+        inotifyDescriptor = -1;
+    }
+#endif
+}
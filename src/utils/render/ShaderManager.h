@@ -0,0 +1,102 @@
+#ifndef GC_SHADERMANAGER_H
+#define GC_SHADERMANAGER_H
+
+#include <GL/glew.h>
+#include <filesystem>
+#include <string>
+#include <vector>
+#include "ShaderPermutation.h"
+
+class ProgramCache;
+
+using namespace std;
+
+// Owns the shader programs - one variant per permutation - and rebuilds them when their sources change. With
+// KHR_parallel_shader_compile the rebuild is compiled off the render thread without blocking the frame. Without it
+// there's no worker context, so the driver may compile and link inside the render thread's calls or defer the work to
+// the status queries a few frames later - either way that frame can hitch. The variants are swapped in together by
+// update() once every one linked. If any variant fails to compile or link, the errors are logged and the last good
+// programs are kept.
+class ShaderManager {
+public:
+    typedef size_t VariantIndex;
+
+private:
+    struct PendingProgram {
+        GLuint programId = 0;
+        GLuint vertexShaderId = 0;
+        GLuint fragmentShaderId = 0;
+    };
+
+    struct Variant {
+        ShaderPermutation permutation;
+        uint32_t key;
+        GLuint programId;
+        PendingProgram pending;
+    };
+
+    ProgramCache *programCache = nullptr;
+    string vertexPath;
+    string fragPath;
+    string vertexSource;
+    string fragSource;
+    // Variant 0 is the default permutation
+    vector<Variant> variants;
+    bool isReloadPending = false;
+    int pendingFramesWaited = 0;
+    bool isParallelCompileSupported = false;
+    bool isHotReloadEnabled = false;
+    bool isReloadRequested = false;
+    int reloadCount = 0;
+    int failedReloadCount = 0;
+
+    // Change detection - inotify on Linux, modification times elsewhere
+    int inotifyDescriptor = -1;
+    vector<string> watchedNames;
+    filesystem::file_time_type lastWriteTimes[2];
+    int framesSincePoll = 0;
+
+    void watchSources();
+
+    bool haveSourcesChanged();
+
+    void beginReload();
+
+    bool isPendingComplete();
+
+    void finishReload();
+
+    static void deletePending(PendingProgram &pending);
+
+public:
+    // Frames to wait before querying a rebuild without KHR_parallel_shader_compile - only gives a driver that compiles
+    // lazily some time, the queries still block until the programs are done
+    static const int PENDING_FRAMES = 3;
+    // Frames between modification time checks without inotify
+    static const int POLL_FRAMES = 30;
+
+    // Compiles (or loads from the cache) the default variant synchronously, false if there's no program to start with
+    bool initialize(ProgramCache &programCache, const string &vertexPath, const string &fragPath,
+                    bool isHotReloadEnabled = true);
+
+    // Returns the existing variant for the permutation or compiles it (through the cache) now. A variant that doesn't
+    // link falls back to the default program.
+    VariantIndex getVariant(const ShaderPermutation &permutation);
+
+    // Call once per frame, true when rebuilt programs were swapped in (uniforms and blocks need binding again)
+    bool update();
+
+    GLuint getProgram(VariantIndex variant = 0) const;
+
+    const ShaderPermutation &getPermutation(VariantIndex variant) const;
+
+    size_t getVariantCount() const;
+
+    int getReloadCount() const;
+
+    int getFailedReloadCount() const;
+
+    void cleanUp();
+};
+
+#endif //GC_SHADERMANAGER_H
@@ -0,0 +1,74 @@
+#include "ShaderPermutation.h"
+#include <algorithm>
+
+ShaderPermutation ShaderPermutation::normalized() const {
+    auto permutation = *this;
+    permutation.lightCount = std::clamp(lightCount, 0, MAX_LIGHT_COUNT);
+    if (permutation.lightCount == 0 && permutation.bakedLighting == BakedLighting::FULL) {
+        // Nothing to replace
+        permutation.bakedLighting = BakedLighting::OCCLUSION;
+    }
+    const auto hasDynamicLights = permutation.lightCount > 0 && permutation.bakedLighting != BakedLighting::FULL;
+    if (!hasDynamicLights && !permutation.hasPointLights) {
+        permutation.hasSpecular = false;
+    }
+    if (!hasDynamicLights) {
+        // The baked light is already shadowed
+        permutation.hasShadows = false;
+    }
+    if (!permutation.hasSpecular) {
+        // The model only changes the highlight
+        permutation.lightingModel = LightingModel::PHONG;
+    }
+    return permutation;
+}
+
+uint32_t ShaderPermutation::getKey() const {
+    const auto permutation = normalized();
+    return (uint32_t) permutation.hasSpecular |
+           (uint32_t) permutation.hasFog << 1 |
+           ((uint32_t) permutation.lightingModel & 0x3u) << 2 |
+           ((uint32_t) permutation.lightCount & 0xFu) << 4 |
+           (uint32_t) permutation.hasPointLights << 8 |
+           ((uint32_t) permutation.bakedLighting & 0x3u) << 9 |
+           (uint32_t) permutation.hasShadows << 11;
+}
+
+string ShaderPermutation::getDefines() const {
+    const auto permutation = normalized();
+    return "#define SPECULAR " + to_string((int) permutation.hasSpecular) + "\n" +
+           "#define FOG " + to_string((int) permutation.hasFog) + "\n" +
+           "#define LIGHTING_MODEL " + to_string((int) permutation.lightingModel) + "\n" +
+           "#define LIGHT_COUNT " + to_string(permutation.lightCount) + "\n" +
+           "#define POINT_LIGHTS " + to_string((int) permutation.hasPointLights) + "\n" +
+           "#define BAKED_LIGHTING " + to_string((int) permutation.bakedLighting) + "\n" +
+           "#define SHADOWS " + to_string((int) permutation.hasShadows) + "\n";
+}
+
+string ShaderPermutation::getName() const {
+    const auto permutation = normalized();
+    auto name = string(permutation.lightingModel == LightingModel::BLINN_PHONG ? "blinn-phong" : "phong") +
+                ", " + to_string(permutation.lightCount) + (permutation.lightCount == 1 ? " light" : " lights");
+    if (permutation.hasSpecular) {
+        name += ", specular";
+    }
+    if (permutation.hasFog) {
+        name += ", fog";
+    }
+    if (permutation.hasPointLights) {
+        name += ", point lights";
+    }
+    if (permutation.bakedLighting == BakedLighting::OCCLUSION) {
+        name += ", baked occlusion";
+    } else if (permutation.bakedLighting == BakedLighting::FULL) {
+        name += ", baked lighting";
+    }
+    if (permutation.hasShadows) {
+        name += ", shadows";
+    }
+    return name;
+}
+
+bool ShaderPermutation::operator==(const ShaderPermutation &other) const {
+    return getKey() == other.getKey();
+}
@@ -0,0 +1,53 @@
+#ifndef GC_SHADERPERMUTATION_H
+#define GC_SHADERPERMUTATION_H
+
+#include <GL/glew.h>
+#include <cstdint>
+#include <string>
+
+using namespace std;
+
+// Matches LIGHTING_MODEL in shader.frag
+enum class LightingModel : GLubyte {
+    PHONG = 0,
+    BLINN_PHONG = 1
+};
+
+// Matches BAKED_LIGHTING in shader.vert & shader.frag
+enum class BakedLighting : GLubyte {
+    NONE = 0,
+    // The ambient light is scaled by the baked occlusion
+    OCCLUSION = 1,
+    // Also replaces the diffuse light of the lightCount lights by the baked (shadowed) one, without specular
+    FULL = 2
+};
+
+// Features compiled into a shader variant through #defines. The defaults match the sources without any defines.
+struct ShaderPermutation {
+    static const int MAX_LIGHT_COUNT = 1; // Lights the frame constants carry
+
+    bool hasSpecular = true;
+    bool hasFog = true;
+    LightingModel lightingModel = LightingModel::PHONG;
+    int lightCount = 1;
+    bool hasPointLights = true; // Clustered, on top of the lightCount lights
+    BakedLighting bakedLighting = BakedLighting::NONE; // Read from the vertices, see LightBaker
+    bool hasShadows = true; // Of the lightCount lights, see ShadowCascades
+
+    // Unused features are dropped (no specular without lights) so equivalent variants share a key
+    ShaderPermutation normalized() const;
+
+    // Identifies the variant - specular, fog, 2 bits of lighting model, 4 bits of light count, point lights,
+    // 2 bits of baked lighting, shadows
+    uint32_t getKey() const;
+
+    // The #define lines to inject, one per feature
+    string getDefines() const;
+
+    // For logging, e.g. "phong, 1 light, specular, fog, point lights, shadows"
+    string getName() const;
+
+    bool operator==(const ShaderPermutation &other) const;
+};
+
+#endif //GC_SHADERPERMUTATION_H
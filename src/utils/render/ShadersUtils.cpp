@@ -1,69 +1,116 @@
 #include "ShadersUtils.h"
 
 GLuint ShadersUtils::loadShaders(const char *vertexShaderPath, const char *fragShaderPath) {
-    ifstream vertexFile, fragFile;
-
-    // Ensure ifstream objects can throw exceptions
-    vertexFile.exceptions(ifstream::failbit | ifstream::badbit);
-    fragFile.exceptions(ifstream::failbit | ifstream::badbit);
-
-    // Read the files
-    string vertexSourceString, fragSourceString;
-    try {
-        // Open the files
-        vertexFile.open(vertexShaderPath);
-        fragFile.open(fragShaderPath);
-
-        // Read the file buffer contents into streams
-        stringstream vertexStream, fragStream;
-        vertexStream << vertexFile.rdbuf();
-        fragStream << fragFile.rdbuf();
-
-        // Close file handlers
-        vertexFile.close();
-        fragFile.close();
-
-        // Convert the stream into x string
-        vertexSourceString = vertexStream.str();
-        fragSourceString = fragStream.str();
-    } catch (ifstream::failure &e) {
-        cout << "ERROR::SHADER::FILE_NOT_SUCCESSFULLY_READ: " << e.what() << endl;
+    GLuint programId = compileProgram(readFile(vertexShaderPath), readFile(fragShaderPath));
+    if (!checkProgram(programId)) {
+        glDeleteProgram(programId);
+        return 0;
     }
+    glUseProgram(programId);
 
-    // Get the C-style strings
-    const char *vertexSource = vertexSourceString.c_str();
-    const char *fragSource = fragSourceString.c_str();
+    return programId;
+}
 
-    GLuint vertexShaderId = glCreateShader(GL_VERTEX_SHADER);
-    glShaderSource(vertexShaderId, 1, &vertexSource, nullptr);
-    glCompileShader(vertexShaderId);
+string ShadersUtils::readFile(const char *path) {
+    ifstream file(path, ios::binary | ios::ate);
+    if (!file) {
+        cout << "ERROR::SHADER::FILE_NOT_SUCCESSFULLY_READ: " << path << endl;
+        return "";
+    }
 
-    int success;
-    char infoLog[512];
-    glGetShaderiv(vertexShaderId, GL_COMPILE_STATUS, &success);
+    string contents((size_t) file.tellg(), '\0');
+    file.seekg(0);
+    file.read(&contents[0], (streamsize) contents.size());
+    return contents;
+}
 
-    if (!success) {
-        glGetShaderInfoLog(vertexShaderId, 512, nullptr, infoLog);
-        cout << "ERROR::SHADER::VERTEX::COMPILATION_FAILED\n" << infoLog << endl;
+string ShadersUtils::injectDefines(const string &source, const string &defines) {
+    if (defines.empty()) {
+        return source;
     }
 
-    GLuint fragmentShaderId = glCreateShader(GL_FRAGMENT_SHADER);
-    glShaderSource(fragmentShaderId, 1, &fragSource, nullptr);
-    glCompileShader(fragmentShaderId);
-
-    glGetShaderiv(fragmentShaderId, GL_COMPILE_STATUS, &success);
+    const auto versionPosition = source.find("#version");
+    if (versionPosition == string::npos) {
+        return defines + source;
+    }
+    auto lineEnd = source.find('\n', versionPosition);
+    lineEnd = lineEnd == string::npos ? source.size() : lineEnd + 1;
 
-    if (!success) {
-        glGetShaderInfoLog(fragmentShaderId, 512, nullptr, infoLog);
-        cout << "ERROR::SHADER::FRAGMENT::COMPILATION_FAILED\n" << infoLog << endl;
+    auto result = source.substr(0, lineEnd);
+    if (result.back() != '\n') {
+        result += '\n';
     }
+    return result + defines + source.substr(lineEnd);
+}
+
+GLuint ShadersUtils::compileProgram(const string &vertexSourceString, const string &fragSourceString,
+                                    bool isBinaryRetrievable) {
+    GLuint vertexShaderId = createShader(GL_VERTEX_SHADER, vertexSourceString);
+    GLuint fragmentShaderId = createShader(GL_FRAGMENT_SHADER, fragSourceString);
+    checkShader(vertexShaderId, "VERTEX");
+    checkShader(fragmentShaderId, "FRAGMENT");
+
+    GLuint programId = createProgram(vertexShaderId, fragmentShaderId, isBinaryRetrievable);
+
+    // The program keeps what it needs
+    glDeleteShader(vertexShaderId);
+    glDeleteShader(fragmentShaderId);
+
+    return programId;
+}
+
+GLuint ShadersUtils::createShader(GLenum type, const string &source) {
+    // Get the C-style string
+    const char *sourceString = source.c_str();
 
+    GLuint shaderId = glCreateShader(type);
+    glShaderSource(shaderId, 1, &sourceString, nullptr);
+    glCompileShader(shaderId);
+
+    return shaderId;
+}
+
+GLuint ShadersUtils::createProgram(GLuint vertexShaderId, GLuint fragmentShaderId, bool isBinaryRetrievable) {
     GLuint programId = glCreateProgram();
+    if (isBinaryRetrievable) {
+        glProgramParameteri(programId, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+    }
     glAttachShader(programId, vertexShaderId);
     glAttachShader(programId, fragmentShaderId);
     glLinkProgram(programId);
-    glUseProgram(programId);
+
+    // Deleting the shaders later only frees them once they're detached
+    glDetachShader(programId, vertexShaderId);
+    glDetachShader(programId, fragmentShaderId);
 
     return programId;
 }
 
+bool ShadersUtils::checkShader(GLuint shaderId, const char *stageName) {
+    int success;
+    char infoLog[512];
+    glGetShaderiv(shaderId, GL_COMPILE_STATUS, &success);
+
+    if (!success) {
+        glGetShaderInfoLog(shaderId, 512, nullptr, infoLog);
+        cout << "ERROR::SHADER::" << stageName << "::COMPILATION_FAILED\n" << infoLog << endl;
+    }
+    return success;
+}
+
+bool ShadersUtils::checkProgram(GLuint programId) {
+    if (isLinked(programId)) {
+        return true;
+    }
+
+    char infoLog[512];
+    glGetProgramInfoLog(programId, 512, nullptr, infoLog);
+    cout << "ERROR::SHADER::PROGRAM::LINKING_FAILED\n" << infoLog << endl;
+    return false;
+}
+
+bool ShadersUtils::isLinked(GLuint programId) {
+    GLint status = GL_FALSE;
+    glGetProgramiv(programId, GL_LINK_STATUS, &status);
+    return status == GL_TRUE;
+}
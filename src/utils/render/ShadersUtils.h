@@ -11,7 +11,30 @@ using namespace std;
 
 class ShadersUtils {
 public:
+    // 0 if the program doesn't link
     static GLuint loadShaders(const char *vertexShaderPath, const char *fragShaderPath);
+
+    // Whole file in one read, empty (with an error printed) if it can't be read
+    static string readFile(const char *path);
+
+    // Compiles & links without binding the program. A retrievable program can be saved with glGetProgramBinary.
+    static GLuint compileProgram(const string &vertexSourceString, const string &fragSourceString,
+                                 bool isBinaryRetrievable = false);
+
+    // Inserts the #define lines right after #version, which has to stay first
+    static string injectDefines(const string &source, const string &defines);
+
+    // Separate stages so a compile can be issued now and its status queried frames later
+    static GLuint createShader(GLenum type, const string &source);
+
+    static GLuint createProgram(GLuint vertexShaderId, GLuint fragmentShaderId, bool isBinaryRetrievable = false);
+
+    // Prints the info log on failure, stageName is e.g. "VERTEX"
+    static bool checkShader(GLuint shaderId, const char *stageName);
+
+    static bool checkProgram(GLuint programId);
+
+    static bool isLinked(GLuint programId);
 };
 
 #endif //GC_SHADERSUTILS_H
@@ -0,0 +1,222 @@
+#include "ShadowCascades.h"
+#include <glm/gtc/matrix_transform.hpp>
+#include <glm/gtc/type_ptr.hpp>
+#include <iostream>
+#include <cfloat>
+#include <cmath>
+#include <cstring>
+
+bool ShadowCascades::initialize(ProgramCache &programCache, const string &vertexShaderPath,
+                                const string &fragShaderPath) {
+    glGenBuffers(1, &ubo);
+    glBindBuffer(GL_UNIFORM_BUFFER, ubo);
+    glBufferData(GL_UNIFORM_BUFFER, sizeof(ShadowConstants), &constants, GL_DYNAMIC_DRAW);
+    glBindBuffer(GL_UNIFORM_BUFFER, 0);
+    glBindBufferBase(GL_UNIFORM_BUFFER, BINDING, ubo);
+
+    // Hardware 2x2 percentage closer filtering, everything outside the maps is lit
+    auto setShadowParameters = [](GLenum target) {
+        const GLfloat border[4] = {1.0f, 1.0f, 1.0f, 1.0f};
+        glTexParameteri(target, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+        glTexParameteri(target, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+        glTexParameteri(target, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_BORDER);
+        glTexParameteri(target, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_BORDER);
+        glTexParameterfv(target, GL_TEXTURE_BORDER_COLOR, border);
+        glTexParameteri(target, GL_TEXTURE_COMPARE_MODE, GL_COMPARE_REF_TO_TEXTURE);
+        glTexParameteri(target, GL_TEXTURE_COMPARE_FUNC, GL_LEQUAL);
+    };
+    glGenTextures(1, &staticTexture);
+    glActiveTexture(GL_TEXTURE0 + STATIC_UNIT);
+    glBindTexture(GL_TEXTURE_2D_ARRAY, staticTexture);
+    glTexImage3D(GL_TEXTURE_2D_ARRAY, 0, GL_DEPTH_COMPONENT24, STATIC_SIZE, STATIC_SIZE, CASCADE_COUNT, 0,
+                 GL_DEPTH_COMPONENT, GL_FLOAT, nullptr);
+    setShadowParameters(GL_TEXTURE_2D_ARRAY);
+    glGenTextures(1, &dynamicTexture);
+    glActiveTexture(GL_TEXTURE0 + DYNAMIC_UNIT);
+    glBindTexture(GL_TEXTURE_2D, dynamicTexture);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_DEPTH_COMPONENT24, DYNAMIC_SIZE, DYNAMIC_SIZE, 0, GL_DEPTH_COMPONENT,
+                 GL_FLOAT, nullptr);
+    setShadowParameters(GL_TEXTURE_2D);
+    glActiveTexture(GL_TEXTURE0);
+
+    program = programCache.loadProgram(vertexShaderPath.c_str(), fragShaderPath.c_str());
+    if (program == 0) {
+        cout << "ERROR::SHADOWS::NO_VALID_PROGRAM" << endl;
+        return false;
+    }
+    lightViewProjectionLocation = glGetUniformLocation(program, "lightViewProjection");
+
+    GLint boundFramebuffer = 0;
+    glGetIntegerv(GL_DRAW_FRAMEBUFFER_BINDING, &boundFramebuffer);
+    glGenFramebuffers(1, &framebuffer);
+    glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+    glFramebufferTextureLayer(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, staticTexture, 0, 0);
+    glDrawBuffer(GL_NONE);
+    glReadBuffer(GL_NONE);
+    const auto status = glCheckFramebufferStatus(GL_FRAMEBUFFER);
+    glBindFramebuffer(GL_FRAMEBUFFER, boundFramebuffer);
+    if (status != GL_FRAMEBUFFER_COMPLETE) {
+        cout << "ERROR::SHADOWS::FRAMEBUFFER_INCOMPLETE " << status << endl;
+        return false;
+    }
+    return true;
+}
+
+void ShadowCascades::bindProgram(GLuint program) {
+    const auto blockIndex = glGetUniformBlockIndex(program, "Shadows");
+    if (blockIndex != GL_INVALID_INDEX) {
+        glUniformBlockBinding(program, blockIndex, BINDING);
+    }
+
+    // The program is in use
+    for (const auto &[name, unit]: {pair<const char *, GLint>{"staticShadowMaps", STATIC_UNIT},
+                                    pair<const char *, GLint>{"dynamicShadowMap", DYNAMIC_UNIT}}) {
+        const auto location = glGetUniformLocation(program, name);
+        if (location != -1) {
+            glUniform1i(location, unit);
+        }
+    }
+}
+
+void ShadowCascades::setLight(vec3 position, const AABB &bounds) {
+    lightPosition = position;
+    casterBounds = bounds;
+    for (auto &cascade: cascades) {
+        cascade.halfAngle = 0.0f;
+    }
+}
+
+void ShadowCascades::update(vec3 cameraPosition, float shadowDistance, bool hasDynamicCasters) {
+    auto updated = constants;
+    const auto casterCenter = casterBounds.getCenter();
+    const auto casterHalfAngle = casterBounds.isEmpty() ? 0.0f :
+                                 getConeHalfAngle(casterCenter, length(casterBounds.getExtent()));
+    for (auto i = 0; i < CASCADE_COUNT; i++) {
+        auto &cascade = cascades[i];
+        const auto radius = shadowDistance * CASCADE_SPLITS[i];
+        const auto snapStep = radius * SNAP_FRACTION;
+        const auto center = floor(cameraPosition / snapStep + 0.5f) * snapStep;
+
+        // Anything within radius of the camera is inside, wherever the camera is within the snapped cell
+        auto target = center;
+        auto halfAngle = getConeHalfAngle(center, radius + snapStep);
+        if (casterHalfAngle > 0.0f && (halfAngle == 0.0f || casterHalfAngle < halfAngle)) {
+            target = casterCenter;
+            halfAngle = casterHalfAngle;
+        } else if (halfAngle == 0.0f) {
+            halfAngle = MAX_HALF_ANGLE;
+        }
+        if (target == cascade.target && halfAngle == cascade.halfAngle) {
+            continue;
+        }
+
+        cascade.target = target;
+        cascade.halfAngle = halfAngle;
+        cascade.isDirty = true;
+        updated.lightViewProjections[i] = getLightViewProjection(target, halfAngle);
+        updated.distances[i] = radius;
+        // Texel size at the target's distance from the light
+        const auto texelSize = 2.0f * length(target - lightPosition) * tanf(halfAngle) / (float) STATIC_SIZE;
+        updated.normalOffsets[i] = NORMAL_OFFSET_TEXELS * texelSize;
+    }
+    updated.parameters.x = hasDynamicCasters ? 1.0f : 0.0f;
+
+    if (memcmp(&updated, &constants, sizeof(ShadowConstants)) != 0) {
+        constants = updated;
+        glBindBuffer(GL_UNIFORM_BUFFER, ubo);
+        glBufferSubData(GL_UNIFORM_BUFFER, 0, sizeof(ShadowConstants), &constants);
+        glBindBuffer(GL_UNIFORM_BUFFER, 0);
+    }
+}
+
+float ShadowCascades::getConeHalfAngle(vec3 center, float radius) const {
+    const auto distance = length(center - lightPosition);
+    if (radius >= distance) {
+        return 0.0f;
+    }
+    return std::min(asinf(radius / distance), MAX_HALF_ANGLE);
+}
+
+mat4 ShadowCascades::getLightViewProjection(vec3 target, float halfAngle) const {
+    const auto direction = normalize(target - lightPosition);
+    const auto up = std::abs(direction.y) > 0.99f ? vec3(0.0f, 0.0f, 1.0f) : vec3(0.0f, 1.0f, 0.0f);
+    const auto lightView = glm::lookAtLH(lightPosition, target, up);
+
+    // Every caster in front of the light is in the depth range, receivers past it compare as the far plane
+    auto minDepth = FLT_MAX, maxDepth = -FLT_MAX;
+    for (auto corner = 0; corner < 8 && !casterBounds.isEmpty(); corner++) {
+        const auto point = vec3(corner & 1 ? casterBounds.max.x : casterBounds.min.x,
+                                corner & 2 ? casterBounds.max.y : casterBounds.min.y,
+                                corner & 4 ? casterBounds.max.z : casterBounds.min.z);
+        const auto depth = (lightView * vec4(point, 1.0f)).z;
+        minDepth = std::min(minDepth, depth);
+        maxDepth = std::max(maxDepth, depth);
+    }
+    const auto nearPlane = casterBounds.isEmpty() ? MIN_NEAR_PLANE : std::max(minDepth - 1.0f, MIN_NEAR_PLANE);
+    const auto farPlane = std::max(maxDepth + 1.0f, 2.0f * nearPlane);
+    return glm::perspectiveLH(2.0f * halfAngle, 1.0f, nearPlane, farPlane) * lightView;
+}
+
+bool ShadowCascades::isStaticDirty(int cascade) const {
+    return cascades[cascade].isDirty;
+}
+
+const mat4 &ShadowCascades::getLightViewProjection(int cascade) const {
+    return constants.lightViewProjections[cascade];
+}
+
+void ShadowCascades::beginStaticPass(int cascade) {
+    beginPass(staticTexture, cascade, STATIC_SIZE, constants.lightViewProjections[cascade]);
+}
+
+void ShadowCascades::endStaticPass(int cascade) {
+    endPass();
+    cascades[cascade].isDirty = false;
+    stats.staticPassCount++;
+}
+
+void ShadowCascades::beginDynamicPass() {
+    beginPass(dynamicTexture, -1, DYNAMIC_SIZE, constants.lightViewProjections[0]);
+}
+
+void ShadowCascades::endDynamicPass() {
+    endPass();
+    stats.dynamicPassCount++;
+}
+
+void ShadowCascades::beginPass(GLuint texture, GLint layer, int size, const mat4 &lightViewProjection) {
+    glGetIntegerv(GL_DRAW_FRAMEBUFFER_BINDING, &previousFramebuffer);
+    glGetIntegerv(GL_VIEWPORT, previousViewport);
+    glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+    if (layer >= 0) {
+        glFramebufferTextureLayer(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, texture, 0, layer);
+    } else {
+        glFramebufferTexture2D(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_TEXTURE_2D, texture, 0);
+    }
+    glViewport(0, 0, size, size);
+    glClear(GL_DEPTH_BUFFER_BIT);
+
+    // Slope scaled bias for the surfaces facing the light at a grazing angle
+    glEnable(GL_POLYGON_OFFSET_FILL);
+    glPolygonOffset(2.0f, 4.0f);
+    glUseProgram(program);
+    glUniformMatrix4fv(lightViewProjectionLocation, 1, GL_FALSE, value_ptr(lightViewProjection));
+}
+
+void ShadowCascades::endPass() {
+    glDisable(GL_POLYGON_OFFSET_FILL);
+    glBindFramebuffer(GL_FRAMEBUFFER, previousFramebuffer);
+    glViewport(previousViewport[0], previousViewport[1], previousViewport[2], previousViewport[3]);
+}
+
+const ShadowStats &ShadowCascades::getStats() const {
+    return stats;
+}
+
+void ShadowCascades::cleanUp() {
+    glDeleteFramebuffers(1, &framebuffer);
+    glDeleteTextures(1, &staticTexture);
+    glDeleteTextures(1, &dynamicTexture);
+    glDeleteBuffers(1, &ubo);
+    glDeleteProgram(program);
+}
@@ -0,0 +1,117 @@
+#ifndef GC_SHADOWCASCADES_H
+#define GC_SHADOWCASCADES_H
+
+#include <GL/glew.h>
+#include <glm/glm.hpp>
+#include <string>
+#include "../cache/ProgramCache.h"
+#include "../culling/AABB.h"
+
+using namespace std;
+using namespace glm;
+
+struct ShadowStats {
+    size_t staticPassCount = 0; // Cascades redrawn, over the whole run
+    size_t dynamicPassCount = 0;
+};
+
+// Point light shadow maps, one cascade per camera distance range. Each cascade is a perspective projection from the
+// light, through the sphere around the camera covering its range - or through the sphere around the casters when that
+// cone is narrower, since a receiver can only be shadowed in a direction that hits a caster. The cascades don't depend
+// on the view direction - the spheres are centered on the camera snapped to a quarter of their radius, so the static
+// geometry is only drawn into a cascade again once the camera moved far enough for it to be re-centered. Moving
+// objects go into a small overlay map over the nearest cascade, redrawn every frame they exist and ignored otherwise.
+class ShadowCascades {
+public:
+    static const int CASCADE_COUNT = 3;
+    // Distance covered by each cascade, as a fraction of the shadow distance
+    static constexpr float CASCADE_SPLITS[CASCADE_COUNT] = {0.08f, 0.3f, 1.0f};
+    static const int STATIC_SIZE = 2048;
+    static const int DYNAMIC_SIZE = 1024;
+
+    static const GLuint BINDING = 3;
+    // Texture units of the shadow samplers in shader.frag
+    static const GLint STATIC_UNIT = 4;
+    static const GLint DYNAMIC_UNIT = 5;
+
+    // The maps start out empty (fully lit), so the shaders can sample them even when nothing is drawn
+    bool initialize(ProgramCache &programCache, const string &vertexShaderPath, const string &fragShaderPath);
+
+    // Points the program's Shadows block and samplers at the maps
+    static void bindProgram(GLuint program);
+
+    // Light at position, and the bounds of everything casting shadows (the depth range of the maps). Every cascade is
+    // drawn again.
+    void setLight(vec3 position, const AABB &bounds);
+
+    // Re-centers the cascades on the camera. Without dynamic casters the overlay isn't sampled.
+    void update(vec3 cameraPosition, float shadowDistance, bool hasDynamicCasters);
+
+    // Whether the static geometry must be drawn into the cascade again
+    bool isStaticDirty(int cascade) const;
+
+    const mat4 &getLightViewProjection(int cascade) const;
+
+    // Binds the cascade's layer & the depth program, for the static geometry
+    void beginStaticPass(int cascade);
+
+    void endStaticPass(int cascade);
+
+    // Binds the overlay & the depth program, for the dynamic geometry - uses the nearest cascade's projection
+    void beginDynamicPass();
+
+    void endDynamicPass();
+
+    const ShadowStats &getStats() const;
+
+    void cleanUp();
+
+private:
+    // Mirrors the std140 Shadows block in shader.frag
+    struct ShadowConstants {
+        mat4 lightViewProjections[CASCADE_COUNT];
+        vec4 distances; // Of the cascades from the camera, 0 while shadows are off
+        vec4 normalOffsets; // Per cascade, in world units
+        vec4 parameters; // x = whether the dynamic overlay is sampled
+    };
+
+    struct Cascade {
+        vec3 target; // Center of the sphere the projection covers
+        float halfAngle = 0.0f; // Of the projection's field of view, 0 until first updated
+        bool isDirty = true;
+    };
+
+    // Sampled positions move along the normal by this many texels, against acne
+    static constexpr float NORMAL_OFFSET_TEXELS = 1.5f;
+    // The cascades are re-centered in steps of this fraction of their radius
+    static constexpr float SNAP_FRACTION = 0.25f;
+    // Widest projection, for a light inside both spheres - directions past it are left unshadowed
+    static constexpr float MAX_HALF_ANGLE = 1.3f;
+    // The depth range starts at least this far from the light, for casters around it
+    static constexpr float MIN_NEAR_PLANE = 1.0f;
+
+    GLuint program = 0;
+    GLint lightViewProjectionLocation = -1;
+    GLuint framebuffer = 0;
+    GLuint staticTexture = 0, dynamicTexture = 0;
+    GLuint ubo = 0;
+    GLint previousFramebuffer = 0;
+    GLint previousViewport[4] = {};
+
+    vec3 lightPosition = vec3(0.0f);
+    AABB casterBounds;
+    Cascade cascades[CASCADE_COUNT];
+    ShadowConstants constants{};
+    ShadowStats stats;
+
+    // Half angle of the cone from the light enclosing the sphere, 0 when the light is inside it
+    float getConeHalfAngle(vec3 center, float radius) const;
+
+    mat4 getLightViewProjection(vec3 target, float halfAngle) const;
+
+    void beginPass(GLuint texture, GLint layer, int size, const mat4 &lightViewProjection);
+
+    void endPass();
+};
+
+#endif //GC_SHADOWCASCADES_H
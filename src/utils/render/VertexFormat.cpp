@@ -0,0 +1,66 @@
+#include "VertexFormat.h"
+
+PackedVertex VertexFormat::pack(vec3 position, vec3 normal, GLubyte material) {
+    PackedVertex vertex{};
+    vertex.position = position;
+    vertex.normal = packNormal(normal);
+    vertex.material = material;
+    // Unoccluded & unlit until baked
+    vertex.occlusion = 255;
+    return vertex;
+}
+
+GLuint VertexFormat::packNormal(vec3 normal) {
+    // Signed normalized 10-10-10-2, w left as 0
+    const auto lengthSquared = dot(normal, normal);
+    if (lengthSquared > 0.0f) {
+        normal /= sqrt(lengthSquared);
+    }
+
+    const auto x = (GLint) round(clamp(normal.x, -1.0f, 1.0f) * 511.0f);
+    const auto y = (GLint) round(clamp(normal.y, -1.0f, 1.0f) * 511.0f);
+    const auto z = (GLint) round(clamp(normal.z, -1.0f, 1.0f) * 511.0f);
+
+    return ((GLuint) x & 0x3FFu) | (((GLuint) y & 0x3FFu) << 10) | (((GLuint) z & 0x3FFu) << 20);
+}
+
+vec3 VertexFormat::unpackNormal(GLuint packedNormal) {
+    // Sign-extend each 10 bit component
+    auto unpackComponent = [](GLuint bits) {
+        auto value = (GLint) (bits & 0x3FFu);
+        if (value & 0x200) {
+            value -= 0x400;
+        }
+        return max((float) value / 511.0f, -1.0f);
+    };
+
+    return vec3(
+            unpackComponent(packedNormal),
+            unpackComponent(packedNormal >> 10),
+            unpackComponent(packedNormal >> 20)
+    );
+}
+
+void VertexFormat::enableInterleavedAttributes() {
+    const auto stride = sizeof(PackedVertex);
+    glEnableVertexAttribArray(0); // 0 = position
+    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, stride, (GLvoid *) offsetof(PackedVertex, position));
+    glEnableVertexAttribArray(1); // 1 = baked occlusion & light
+    glVertexAttribPointer(1, 2, GL_UNSIGNED_BYTE, GL_TRUE, stride, (GLvoid *) offsetof(PackedVertex, occlusion));
+    glEnableVertexAttribArray(2); // 2 = material
+    glVertexAttribPointer(2, 1, GL_UNSIGNED_BYTE, GL_FALSE, stride, (GLvoid *) offsetof(PackedVertex, material));
+    glEnableVertexAttribArray(3); // 3 = normals
+    glVertexAttribPointer(3, 4, GL_INT_2_10_10_10_REV, GL_TRUE, stride, (GLvoid *) offsetof(PackedVertex, normal));
+}
+
+size_t VertexFormat::bytesPerVertex(VertexLayout layout) {
+    if (layout == VertexLayout::INTERLEAVED) {
+        return sizeof(PackedVertex);
+    }
+    // Position, material, normal, baked lighting
+    return sizeof(vec3) + sizeof(GLfloat) + sizeof(vec3) + 2 * sizeof(GLubyte);
+}
+
+const char *VertexFormat::layoutName(VertexLayout layout) {
+    return layout == VertexLayout::INTERLEAVED ? "interleaved" : "planar";
+}
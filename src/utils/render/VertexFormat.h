@@ -0,0 +1,45 @@
+#ifndef GC_VERTEXFORMAT_H
+#define GC_VERTEXFORMAT_H
+
+#include <GL/glew.h>
+#include <glm/glm.hpp>
+#include <cstddef>
+
+using namespace glm;
+
+enum class VertexLayout {
+    // Four separate blocks (positions, materials, normals, baked lighting), 30 bytes per vertex
+    PLANAR,
+    // A single interleaved PackedVertex stream, 20 bytes per vertex
+    INTERLEAVED
+};
+
+struct PackedVertex {
+    vec3 position;
+    GLuint normal; // GL_INT_2_10_10_10_REV
+    GLubyte material; // Index into the MaterialTable, which holds the color
+    // Baked by LightBaker - unoccluded fraction of the hemisphere & diffuse light from lightPosition, normalized
+    GLubyte occlusion;
+    GLubyte light;
+    GLubyte padding;
+};
+
+static_assert(sizeof(PackedVertex) == 20, "PackedVertex must stay tightly packed");
+
+class VertexFormat {
+public:
+    static PackedVertex pack(vec3 position, vec3 normal, GLubyte material);
+
+    static GLuint packNormal(vec3 normal);
+
+    static vec3 unpackNormal(GLuint packedNormal);
+
+    // Attribute pointers for a PackedVertex stream bound to GL_ARRAY_BUFFER (locations 0 to 3)
+    static void enableInterleavedAttributes();
+
+    static size_t bytesPerVertex(VertexLayout layout);
+
+    static const char *layoutName(VertexLayout layout);
+};
+
+#endif //GC_VERTEXFORMAT_H